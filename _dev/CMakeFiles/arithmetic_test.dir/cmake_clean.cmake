@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arithmetic_test.dir/hwy/tests/arithmetic_test.cc.o"
+  "CMakeFiles/arithmetic_test.dir/hwy/tests/arithmetic_test.cc.o.d"
+  "arithmetic_test[1]_tests.cmake"
+  "tests/arithmetic_test"
+  "tests/arithmetic_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_sort.dir/hwy/contrib/sort/bench_sort.cc.o"
+  "CMakeFiles/bench_sort.dir/hwy/contrib/sort/bench_sort.cc.o.d"
+  "bench_sort[1]_tests.cmake"
+  "tests/bench_sort"
+  "tests/bench_sort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_sort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_thread_pool.dir/hwy/contrib/thread_pool/bench_thread_pool.cc.o"
+  "CMakeFiles/bench_thread_pool.dir/hwy/contrib/thread_pool/bench_thread_pool.cc.o.d"
+  "bench_thread_pool[1]_tests.cmake"
+  "tests/bench_thread_pool"
+  "tests/bench_thread_pool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_thread_pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bit_pack_test.dir/hwy/contrib/bit_pack/bit_pack_test.cc.o"
+  "CMakeFiles/bit_pack_test.dir/hwy/contrib/bit_pack/bit_pack_test.cc.o.d"
+  "bit_pack_test[1]_tests.cmake"
+  "tests/bit_pack_test"
+  "tests/bit_pack_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bit_pack_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
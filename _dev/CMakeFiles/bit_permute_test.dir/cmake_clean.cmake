@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bit_permute_test.dir/hwy/tests/bit_permute_test.cc.o"
+  "CMakeFiles/bit_permute_test.dir/hwy/tests/bit_permute_test.cc.o.d"
+  "bit_permute_test[1]_tests.cmake"
+  "tests/bit_permute_test"
+  "tests/bit_permute_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bit_permute_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bit_set_test.dir/hwy/bit_set_test.cc.o"
+  "CMakeFiles/bit_set_test.dir/hwy/bit_set_test.cc.o.d"
+  "bit_set_test[1]_tests.cmake"
+  "tests/bit_set_test"
+  "tests/bit_set_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bit_set_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/blockwise_test.dir/hwy/tests/blockwise_test.cc.o"
+  "CMakeFiles/blockwise_test.dir/hwy/tests/blockwise_test.cc.o.d"
+  "blockwise_test[1]_tests.cmake"
+  "tests/blockwise_test"
+  "tests/blockwise_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blockwise_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
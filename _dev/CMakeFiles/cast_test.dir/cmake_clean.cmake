@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cast_test.dir/hwy/tests/cast_test.cc.o"
+  "CMakeFiles/cast_test.dir/hwy/tests/cast_test.cc.o.d"
+  "cast_test[1]_tests.cmake"
+  "tests/cast_test"
+  "tests/cast_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cast_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
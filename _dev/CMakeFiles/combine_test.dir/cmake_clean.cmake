@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/combine_test.dir/hwy/tests/combine_test.cc.o"
+  "CMakeFiles/combine_test.dir/hwy/tests/combine_test.cc.o.d"
+  "combine_test[1]_tests.cmake"
+  "tests/combine_test"
+  "tests/combine_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/combine_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
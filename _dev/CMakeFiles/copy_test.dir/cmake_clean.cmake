@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_test.dir/hwy/contrib/algo/copy_test.cc.o"
+  "CMakeFiles/copy_test.dir/hwy/contrib/algo/copy_test.cc.o.d"
+  "copy_test[1]_tests.cmake"
+  "tests/copy_test"
+  "tests/copy_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/copy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/count_test.dir/hwy/tests/count_test.cc.o"
+  "CMakeFiles/count_test.dir/hwy/tests/count_test.cc.o.d"
+  "count_test[1]_tests.cmake"
+  "tests/count_test"
+  "tests/count_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/count_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
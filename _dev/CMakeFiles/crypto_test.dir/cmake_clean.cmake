@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crypto_test.dir/hwy/tests/crypto_test.cc.o"
+  "CMakeFiles/crypto_test.dir/hwy/tests/crypto_test.cc.o.d"
+  "crypto_test[1]_tests.cmake"
+  "tests/crypto_test"
+  "tests/crypto_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/crypto_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/demote_test.dir/hwy/tests/demote_test.cc.o"
+  "CMakeFiles/demote_test.dir/hwy/tests/demote_test.cc.o.d"
+  "demote_test[1]_tests.cmake"
+  "tests/demote_test"
+  "tests/demote_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/demote_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/div_test.dir/hwy/tests/div_test.cc.o"
+  "CMakeFiles/div_test.dir/hwy/tests/div_test.cc.o.d"
+  "div_test[1]_tests.cmake"
+  "tests/div_test"
+  "tests/div_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/div_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dup128_vec_test.dir/hwy/tests/dup128_vec_test.cc.o"
+  "CMakeFiles/dup128_vec_test.dir/hwy/tests/dup128_vec_test.cc.o.d"
+  "dup128_vec_test[1]_tests.cmake"
+  "tests/dup128_vec_test"
+  "tests/dup128_vec_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dup128_vec_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
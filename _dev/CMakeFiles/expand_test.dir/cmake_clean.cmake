@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/expand_test.dir/hwy/tests/expand_test.cc.o"
+  "CMakeFiles/expand_test.dir/hwy/tests/expand_test.cc.o.d"
+  "expand_test[1]_tests.cmake"
+  "tests/expand_test"
+  "tests/expand_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/expand_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/foreach_vec_test.dir/hwy/tests/foreach_vec_test.cc.o"
+  "CMakeFiles/foreach_vec_test.dir/hwy/tests/foreach_vec_test.cc.o.d"
+  "foreach_vec_test[1]_tests.cmake"
+  "tests/foreach_vec_test"
+  "tests/foreach_vec_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/foreach_vec_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
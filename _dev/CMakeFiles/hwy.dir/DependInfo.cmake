@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/hwy/abort.cc" "CMakeFiles/hwy.dir/hwy/abort.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/abort.cc.o.d"
+  "/root/repo/hwy/aligned_allocator.cc" "CMakeFiles/hwy.dir/hwy/aligned_allocator.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/aligned_allocator.cc.o.d"
+  "/root/repo/hwy/nanobenchmark.cc" "CMakeFiles/hwy.dir/hwy/nanobenchmark.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/nanobenchmark.cc.o.d"
+  "/root/repo/hwy/per_target.cc" "CMakeFiles/hwy.dir/hwy/per_target.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/per_target.cc.o.d"
+  "/root/repo/hwy/print.cc" "CMakeFiles/hwy.dir/hwy/print.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/print.cc.o.d"
+  "/root/repo/hwy/targets.cc" "CMakeFiles/hwy.dir/hwy/targets.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/targets.cc.o.d"
+  "/root/repo/hwy/timer.cc" "CMakeFiles/hwy.dir/hwy/timer.cc.o" "gcc" "CMakeFiles/hwy.dir/hwy/timer.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
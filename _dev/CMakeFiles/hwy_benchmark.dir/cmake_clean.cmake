@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hwy_benchmark.dir/hwy/examples/benchmark.cc.o"
+  "CMakeFiles/hwy_benchmark.dir/hwy/examples/benchmark.cc.o.d"
+  "examples/hwy_benchmark"
+  "examples/hwy_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hwy_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
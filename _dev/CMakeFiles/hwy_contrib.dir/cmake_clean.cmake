@@ -0,0 +1,79 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/image/image.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/image/image.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_128d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_argsort.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_argsort.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_by.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_by.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f16d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f32d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_f64d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_float.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_float.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i16d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i32d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_i64d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv128d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_kv64d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_merge.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_merge.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_segments.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_segments.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_string.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_string.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_topk.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_topk.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u16d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u32d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64a.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64a.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64d.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_u64d.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_unique.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/sort/vqsort_unique.cc.o.d"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/thread_pool/topology.cc.o"
+  "CMakeFiles/hwy_contrib.dir/hwy/contrib/thread_pool/topology.cc.o.d"
+  "libhwy_contrib.a"
+  "libhwy_contrib.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hwy_contrib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
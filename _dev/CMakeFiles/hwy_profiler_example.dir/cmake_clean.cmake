@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hwy_profiler_example.dir/hwy/examples/profiler_example.cc.o"
+  "CMakeFiles/hwy_profiler_example.dir/hwy/examples/profiler_example.cc.o.d"
+  "examples/hwy_profiler_example"
+  "examples/hwy_profiler_example.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hwy_profiler_example.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
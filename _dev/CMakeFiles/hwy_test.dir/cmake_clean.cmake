@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hwy_test.dir/hwy/tests/test_util.cc.o"
+  "CMakeFiles/hwy_test.dir/hwy/tests/test_util.cc.o.d"
+  "libhwy_test.a"
+  "libhwy_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hwy_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
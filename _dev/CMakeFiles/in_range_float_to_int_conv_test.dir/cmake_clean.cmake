@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/in_range_float_to_int_conv_test.dir/hwy/tests/in_range_float_to_int_conv_test.cc.o"
+  "CMakeFiles/in_range_float_to_int_conv_test.dir/hwy/tests/in_range_float_to_int_conv_test.cc.o.d"
+  "in_range_float_to_int_conv_test[1]_tests.cmake"
+  "tests/in_range_float_to_int_conv_test"
+  "tests/in_range_float_to_int_conv_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/in_range_float_to_int_conv_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
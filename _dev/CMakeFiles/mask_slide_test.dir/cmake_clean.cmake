@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mask_slide_test.dir/hwy/tests/mask_slide_test.cc.o"
+  "CMakeFiles/mask_slide_test.dir/hwy/tests/mask_slide_test.cc.o.d"
+  "mask_slide_test[1]_tests.cmake"
+  "tests/mask_slide_test"
+  "tests/mask_slide_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mask_slide_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
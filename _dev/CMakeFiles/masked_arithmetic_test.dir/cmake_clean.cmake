@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/masked_arithmetic_test.dir/hwy/tests/masked_arithmetic_test.cc.o"
+  "CMakeFiles/masked_arithmetic_test.dir/hwy/tests/masked_arithmetic_test.cc.o.d"
+  "masked_arithmetic_test[1]_tests.cmake"
+  "tests/masked_arithmetic_test"
+  "tests/masked_arithmetic_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/masked_arithmetic_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/masked_minmax_test.dir/hwy/tests/masked_minmax_test.cc.o"
+  "CMakeFiles/masked_minmax_test.dir/hwy/tests/masked_minmax_test.cc.o.d"
+  "masked_minmax_test[1]_tests.cmake"
+  "tests/masked_minmax_test"
+  "tests/masked_minmax_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/masked_minmax_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/math_test.dir/hwy/contrib/math/math_test.cc.o"
+  "CMakeFiles/math_test.dir/hwy/contrib/math/math_test.cc.o.d"
+  "math_test[1]_tests.cmake"
+  "tests/math_test"
+  "tests/math_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/math_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/matvec_test.dir/hwy/contrib/matvec/matvec_test.cc.o"
+  "CMakeFiles/matvec_test.dir/hwy/contrib/matvec/matvec_test.cc.o.d"
+  "matvec_test[1]_tests.cmake"
+  "tests/matvec_test"
+  "tests/matvec_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/matvec_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memory_test.dir/hwy/tests/memory_test.cc.o"
+  "CMakeFiles/memory_test.dir/hwy/tests/memory_test.cc.o.d"
+  "memory_test[1]_tests.cmake"
+  "tests/memory_test"
+  "tests/memory_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memory_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
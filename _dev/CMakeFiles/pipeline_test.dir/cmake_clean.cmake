@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pipeline_test.dir/hwy/contrib/thread_pool/pipeline_test.cc.o"
+  "CMakeFiles/pipeline_test.dir/hwy/contrib/thread_pool/pipeline_test.cc.o.d"
+  "pipeline_test[1]_tests.cmake"
+  "tests/pipeline_test"
+  "tests/pipeline_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipeline_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/random_test.dir/hwy/contrib/random/random_test.cc.o"
+  "CMakeFiles/random_test.dir/hwy/contrib/random/random_test.cc.o.d"
+  "random_test[1]_tests.cmake"
+  "tests/random_test"
+  "tests/random_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/resize_test.dir/hwy/tests/resize_test.cc.o"
+  "CMakeFiles/resize_test.dir/hwy/tests/resize_test.cc.o.d"
+  "resize_test[1]_tests.cmake"
+  "tests/resize_test"
+  "tests/resize_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resize_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/saturated_test.dir/hwy/tests/saturated_test.cc.o"
+  "CMakeFiles/saturated_test.dir/hwy/tests/saturated_test.cc.o.d"
+  "saturated_test[1]_tests.cmake"
+  "tests/saturated_test"
+  "tests/saturated_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/saturated_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shuffle4_test.dir/hwy/tests/shuffle4_test.cc.o"
+  "CMakeFiles/shuffle4_test.dir/hwy/tests/shuffle4_test.cc.o.d"
+  "shuffle4_test[1]_tests.cmake"
+  "tests/shuffle4_test"
+  "tests/shuffle4_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shuffle4_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sign_test.dir/hwy/tests/sign_test.cc.o"
+  "CMakeFiles/sign_test.dir/hwy/tests/sign_test.cc.o.d"
+  "sign_test[1]_tests.cmake"
+  "tests/sign_test"
+  "tests/sign_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sign_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
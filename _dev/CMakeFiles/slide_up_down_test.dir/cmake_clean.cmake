@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slide_up_down_test.dir/hwy/tests/slide_up_down_test.cc.o"
+  "CMakeFiles/slide_up_down_test.dir/hwy/tests/slide_up_down_test.cc.o.d"
+  "slide_up_down_test[1]_tests.cmake"
+  "tests/slide_up_down_test"
+  "tests/slide_up_down_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slide_up_down_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
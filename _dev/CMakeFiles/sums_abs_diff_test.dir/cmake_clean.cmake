@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sums_abs_diff_test.dir/hwy/tests/sums_abs_diff_test.cc.o"
+  "CMakeFiles/sums_abs_diff_test.dir/hwy/tests/sums_abs_diff_test.cc.o.d"
+  "sums_abs_diff_test[1]_tests.cmake"
+  "tests/sums_abs_diff_test"
+  "tests/sums_abs_diff_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sums_abs_diff_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
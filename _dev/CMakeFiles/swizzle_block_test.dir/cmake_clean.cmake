@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swizzle_block_test.dir/hwy/tests/swizzle_block_test.cc.o"
+  "CMakeFiles/swizzle_block_test.dir/hwy/tests/swizzle_block_test.cc.o.d"
+  "swizzle_block_test[1]_tests.cmake"
+  "tests/swizzle_block_test"
+  "tests/swizzle_block_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swizzle_block_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/swizzle_test.dir/hwy/tests/swizzle_test.cc.o"
+  "CMakeFiles/swizzle_test.dir/hwy/tests/swizzle_test.cc.o.d"
+  "swizzle_test[1]_tests.cmake"
+  "tests/swizzle_test"
+  "tests/swizzle_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/swizzle_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
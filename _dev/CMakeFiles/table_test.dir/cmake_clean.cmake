@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/table_test.dir/hwy/tests/table_test.cc.o"
+  "CMakeFiles/table_test.dir/hwy/tests/table_test.cc.o.d"
+  "table_test[1]_tests.cmake"
+  "tests/table_test"
+  "tests/table_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/table_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
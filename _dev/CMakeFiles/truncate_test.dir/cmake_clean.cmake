@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/truncate_test.dir/hwy/tests/truncate_test.cc.o"
+  "CMakeFiles/truncate_test.dir/hwy/tests/truncate_test.cc.o.d"
+  "tests/truncate_test"
+  "tests/truncate_test.pdb"
+  "truncate_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/truncate_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
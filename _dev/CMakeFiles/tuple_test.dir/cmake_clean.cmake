@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tuple_test.dir/hwy/tests/tuple_test.cc.o"
+  "CMakeFiles/tuple_test.dir/hwy/tests/tuple_test.cc.o.d"
+  "tests/tuple_test"
+  "tests/tuple_test.pdb"
+  "tuple_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tuple_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
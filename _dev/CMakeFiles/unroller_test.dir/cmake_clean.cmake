@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unroller_test.dir/hwy/contrib/unroller/unroller_test.cc.o"
+  "CMakeFiles/unroller_test.dir/hwy/contrib/unroller/unroller_test.cc.o.d"
+  "tests/unroller_test"
+  "tests/unroller_test.pdb"
+  "unroller_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unroller_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/widen_mul_test.dir/hwy/tests/widen_mul_test.cc.o"
+  "CMakeFiles/widen_mul_test.dir/hwy/tests/widen_mul_test.cc.o.d"
+  "tests/widen_mul_test"
+  "tests/widen_mul_test.pdb"
+  "widen_mul_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/widen_mul_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,77 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_dev
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_dev/copy_test[1]_include.cmake")
+include("/root/repo/_dev/find_test[1]_include.cmake")
+include("/root/repo/_dev/transform_test[1]_include.cmake")
+include("/root/repo/_dev/abort_test[1]_include.cmake")
+include("/root/repo/_dev/aligned_allocator_test[1]_include.cmake")
+include("/root/repo/_dev/base_test[1]_include.cmake")
+include("/root/repo/_dev/bit_set_test[1]_include.cmake")
+include("/root/repo/_dev/highway_test[1]_include.cmake")
+include("/root/repo/_dev/nanobenchmark_test[1]_include.cmake")
+include("/root/repo/_dev/targets_test[1]_include.cmake")
+include("/root/repo/_dev/skeleton_test[1]_include.cmake")
+include("/root/repo/_dev/arithmetic_test[1]_include.cmake")
+include("/root/repo/_dev/bit_permute_test[1]_include.cmake")
+include("/root/repo/_dev/blockwise_shift_test[1]_include.cmake")
+include("/root/repo/_dev/blockwise_test[1]_include.cmake")
+include("/root/repo/_dev/cast_test[1]_include.cmake")
+include("/root/repo/_dev/combine_test[1]_include.cmake")
+include("/root/repo/_dev/compare_test[1]_include.cmake")
+include("/root/repo/_dev/compress_test[1]_include.cmake")
+include("/root/repo/_dev/convert_test[1]_include.cmake")
+include("/root/repo/_dev/count_test[1]_include.cmake")
+include("/root/repo/_dev/crypto_test[1]_include.cmake")
+include("/root/repo/_dev/demote_test[1]_include.cmake")
+include("/root/repo/_dev/div_test[1]_include.cmake")
+include("/root/repo/_dev/dup128_vec_test[1]_include.cmake")
+include("/root/repo/_dev/expand_test[1]_include.cmake")
+include("/root/repo/_dev/float_test[1]_include.cmake")
+include("/root/repo/_dev/foreach_vec_test[1]_include.cmake")
+include("/root/repo/_dev/if_test[1]_include.cmake")
+include("/root/repo/_dev/in_range_float_to_int_conv_test[1]_include.cmake")
+include("/root/repo/_dev/interleaved_test[1]_include.cmake")
+include("/root/repo/_dev/logical_test[1]_include.cmake")
+include("/root/repo/_dev/mask_combine_test[1]_include.cmake")
+include("/root/repo/_dev/mask_convert_test[1]_include.cmake")
+include("/root/repo/_dev/mask_mem_test[1]_include.cmake")
+include("/root/repo/_dev/mask_slide_test[1]_include.cmake")
+include("/root/repo/_dev/mask_test[1]_include.cmake")
+include("/root/repo/_dev/masked_arithmetic_test[1]_include.cmake")
+include("/root/repo/_dev/masked_minmax_test[1]_include.cmake")
+include("/root/repo/_dev/memory_test[1]_include.cmake")
+include("/root/repo/_dev/minmax_test[1]_include.cmake")
+include("/root/repo/_dev/mul_test[1]_include.cmake")
+include("/root/repo/_dev/reduction_test[1]_include.cmake")
+include("/root/repo/_dev/resize_test[1]_include.cmake")
+include("/root/repo/_dev/reverse_test[1]_include.cmake")
+include("/root/repo/_dev/saturated_test[1]_include.cmake")
+include("/root/repo/_dev/shift_test[1]_include.cmake")
+include("/root/repo/_dev/shuffle4_test[1]_include.cmake")
+include("/root/repo/_dev/sign_test[1]_include.cmake")
+include("/root/repo/_dev/slide_up_down_test[1]_include.cmake")
+include("/root/repo/_dev/sums_abs_diff_test[1]_include.cmake")
+include("/root/repo/_dev/swizzle_block_test[1]_include.cmake")
+include("/root/repo/_dev/swizzle_test[1]_include.cmake")
+include("/root/repo/_dev/table_test[1]_include.cmake")
+include("/root/repo/_dev/test_util_test[1]_include.cmake")
+include("/root/repo/_dev/truncate_test[1]_include.cmake")
+include("/root/repo/_dev/tuple_test[1]_include.cmake")
+include("/root/repo/_dev/widen_mul_test[1]_include.cmake")
+include("/root/repo/_dev/bit_pack_test[1]_include.cmake")
+include("/root/repo/_dev/dot_test[1]_include.cmake")
+include("/root/repo/_dev/matvec_test[1]_include.cmake")
+include("/root/repo/_dev/image_test[1]_include.cmake")
+include("/root/repo/_dev/math_test[1]_include.cmake")
+include("/root/repo/_dev/random_test[1]_include.cmake")
+include("/root/repo/_dev/sort_test[1]_include.cmake")
+include("/root/repo/_dev/bench_sort[1]_include.cmake")
+include("/root/repo/_dev/bench_thread_pool[1]_include.cmake")
+include("/root/repo/_dev/pipeline_test[1]_include.cmake")
+include("/root/repo/_dev/thread_pool_test[1]_include.cmake")
+include("/root/repo/_dev/topology_test[1]_include.cmake")
+include("/root/repo/_dev/unroller_test[1]_include.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/abort_test[1]_tests.cmake")
+  include("/root/repo/_dev/abort_test[1]_tests.cmake")
+else()
+  add_test(abort_test_NOT_BUILT abort_test_NOT_BUILT)
+endif()
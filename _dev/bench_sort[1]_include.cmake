@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/bench_sort[1]_tests.cmake")
+  include("/root/repo/_dev/bench_sort[1]_tests.cmake")
+else()
+  add_test(bench_sort_NOT_BUILT bench_sort_NOT_BUILT)
+endif()
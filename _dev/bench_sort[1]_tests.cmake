@@ -0,0 +1,5 @@
+add_test([=[BenchSortGroup/BenchSort.BenchAllColdSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/bench_sort [==[--gtest_filter=BenchSortGroup/BenchSort.BenchAllColdSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchSortGroup/BenchSort.BenchAllColdSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BenchSortGroup/BenchSort.BenchAllSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/bench_sort [==[--gtest_filter=BenchSortGroup/BenchSort.BenchAllSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BenchSortGroup/BenchSort.BenchAllSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  bench_sort_TESTS [==[BenchSortGroup/BenchSort.BenchAllColdSort/SSE2  # GetParam() = 16384]==] [==[BenchSortGroup/BenchSort.BenchAllSort/SSE2  # GetParam() = 16384]==])
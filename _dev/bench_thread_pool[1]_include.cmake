@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/bench_thread_pool[1]_tests.cmake")
+  include("/root/repo/_dev/bench_thread_pool[1]_tests.cmake")
+else()
+  add_test(bench_thread_pool_NOT_BUILT bench_thread_pool_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/bit_pack_test[1]_tests.cmake")
+  include("/root/repo/_dev/bit_pack_test[1]_tests.cmake")
+else()
+  add_test(bit_pack_test_NOT_BUILT bit_pack_test_NOT_BUILT)
+endif()
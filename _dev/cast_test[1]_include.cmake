@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/cast_test[1]_tests.cmake")
+  include("/root/repo/_dev/cast_test[1]_tests.cmake")
+else()
+  add_test(cast_test_NOT_BUILT cast_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/combine_test[1]_tests.cmake")
+  include("/root/repo/_dev/combine_test[1]_tests.cmake")
+else()
+  add_test(combine_test_NOT_BUILT combine_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/count_test[1]_tests.cmake")
+  include("/root/repo/_dev/count_test[1]_tests.cmake")
+else()
+  add_test(count_test_NOT_BUILT count_test_NOT_BUILT)
+endif()
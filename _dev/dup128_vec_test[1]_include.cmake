@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/dup128_vec_test[1]_tests.cmake")
+  include("/root/repo/_dev/dup128_vec_test[1]_tests.cmake")
+else()
+  add_test(dup128_vec_test_NOT_BUILT dup128_vec_test_NOT_BUILT)
+endif()
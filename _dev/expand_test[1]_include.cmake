@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/expand_test[1]_tests.cmake")
+  include("/root/repo/_dev/expand_test[1]_tests.cmake")
+else()
+  add_test(expand_test_NOT_BUILT expand_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/foreach_vec_test[1]_tests.cmake")
+  include("/root/repo/_dev/foreach_vec_test[1]_tests.cmake")
+else()
+  add_test(foreach_vec_test_NOT_BUILT foreach_vec_test_NOT_BUILT)
+endif()
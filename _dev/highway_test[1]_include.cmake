@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/highway_test[1]_tests.cmake")
+  include("/root/repo/_dev/highway_test[1]_tests.cmake")
+else()
+  add_test(highway_test_NOT_BUILT highway_test_NOT_BUILT)
+endif()
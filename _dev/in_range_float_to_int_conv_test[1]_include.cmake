@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/in_range_float_to_int_conv_test[1]_tests.cmake")
+  include("/root/repo/_dev/in_range_float_to_int_conv_test[1]_tests.cmake")
+else()
+  add_test(in_range_float_to_int_conv_test_NOT_BUILT in_range_float_to_int_conv_test_NOT_BUILT)
+endif()
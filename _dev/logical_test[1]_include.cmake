@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/logical_test[1]_tests.cmake")
+  include("/root/repo/_dev/logical_test[1]_tests.cmake")
+else()
+  add_test(logical_test_NOT_BUILT logical_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/mask_convert_test[1]_tests.cmake")
+  include("/root/repo/_dev/mask_convert_test[1]_tests.cmake")
+else()
+  add_test(mask_convert_test_NOT_BUILT mask_convert_test_NOT_BUILT)
+endif()
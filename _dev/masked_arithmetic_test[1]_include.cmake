@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/masked_arithmetic_test[1]_tests.cmake")
+  include("/root/repo/_dev/masked_arithmetic_test[1]_tests.cmake")
+else()
+  add_test(masked_arithmetic_test_NOT_BUILT masked_arithmetic_test_NOT_BUILT)
+endif()
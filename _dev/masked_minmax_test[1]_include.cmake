@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/masked_minmax_test[1]_tests.cmake")
+  include("/root/repo/_dev/masked_minmax_test[1]_tests.cmake")
+else()
+  add_test(masked_minmax_test_NOT_BUILT masked_minmax_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/matvec_test[1]_tests.cmake")
+  include("/root/repo/_dev/matvec_test[1]_tests.cmake")
+else()
+  add_test(matvec_test_NOT_BUILT matvec_test_NOT_BUILT)
+endif()
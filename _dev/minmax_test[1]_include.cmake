@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/minmax_test[1]_tests.cmake")
+  include("/root/repo/_dev/minmax_test[1]_tests.cmake")
+else()
+  add_test(minmax_test_NOT_BUILT minmax_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/mul_test[1]_tests.cmake")
+  include("/root/repo/_dev/mul_test[1]_tests.cmake")
+else()
+  add_test(mul_test_NOT_BUILT mul_test_NOT_BUILT)
+endif()
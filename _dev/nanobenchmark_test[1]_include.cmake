@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/nanobenchmark_test[1]_tests.cmake")
+  include("/root/repo/_dev/nanobenchmark_test[1]_tests.cmake")
+else()
+  add_test(nanobenchmark_test_NOT_BUILT nanobenchmark_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/pipeline_test[1]_tests.cmake")
+  include("/root/repo/_dev/pipeline_test[1]_tests.cmake")
+else()
+  add_test(pipeline_test_NOT_BUILT pipeline_test_NOT_BUILT)
+endif()
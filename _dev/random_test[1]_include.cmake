@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/random_test[1]_tests.cmake")
+  include("/root/repo/_dev/random_test[1]_tests.cmake")
+else()
+  add_test(random_test_NOT_BUILT random_test_NOT_BUILT)
+endif()
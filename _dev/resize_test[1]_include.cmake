@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/resize_test[1]_tests.cmake")
+  include("/root/repo/_dev/resize_test[1]_tests.cmake")
+else()
+  add_test(resize_test_NOT_BUILT resize_test_NOT_BUILT)
+endif()
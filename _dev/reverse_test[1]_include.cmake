@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/reverse_test[1]_tests.cmake")
+  include("/root/repo/_dev/reverse_test[1]_tests.cmake")
+else()
+  add_test(reverse_test_NOT_BUILT reverse_test_NOT_BUILT)
+endif()
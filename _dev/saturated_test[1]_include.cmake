@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/saturated_test[1]_tests.cmake")
+  include("/root/repo/_dev/saturated_test[1]_tests.cmake")
+else()
+  add_test(saturated_test_NOT_BUILT saturated_test_NOT_BUILT)
+endif()
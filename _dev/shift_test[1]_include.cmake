@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/shift_test[1]_tests.cmake")
+  include("/root/repo/_dev/shift_test[1]_tests.cmake")
+else()
+  add_test(shift_test_NOT_BUILT shift_test_NOT_BUILT)
+endif()
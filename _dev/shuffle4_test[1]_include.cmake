@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/shuffle4_test[1]_tests.cmake")
+  include("/root/repo/_dev/shuffle4_test[1]_tests.cmake")
+else()
+  add_test(shuffle4_test_NOT_BUILT shuffle4_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/sign_test[1]_tests.cmake")
+  include("/root/repo/_dev/sign_test[1]_tests.cmake")
+else()
+  add_test(sign_test_NOT_BUILT sign_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/slide_up_down_test[1]_tests.cmake")
+  include("/root/repo/_dev/slide_up_down_test[1]_tests.cmake")
+else()
+  add_test(slide_up_down_test_NOT_BUILT slide_up_down_test_NOT_BUILT)
+endif()
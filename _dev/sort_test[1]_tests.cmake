@@ -0,0 +1,41 @@
+add_test([=[SortTestGroup/SortTest.TestAllFloatLargerSmaller/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllFloatLargerSmaller/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllFloatLargerSmaller/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllFloatInf/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllFloatInf/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllFloatInf/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllMedian/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllMedian/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllMedian/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllBaseCase/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllBaseCase/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllBaseCase/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPartition/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPartition/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPartition/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllGenerator/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllGenerator/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllGenerator/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllVQSorter/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllVQSorter/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllVQSorter/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllParallelSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllParallelSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllParallelSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllArgSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllArgSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllArgSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllTopK/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllTopK/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllTopK/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllStableSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllStableSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllStableSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortNaN/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortNaN/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortNaN/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllUnique/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllUnique/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllUnique/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortBy/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortBy/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortBy/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortSegments/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortSegments/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortSegments/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSortStrings/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSortStrings/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSortStrings/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllMerge/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllMerge/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllMerge/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllSelect/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllSelect/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllSelect/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SortTestGroup/SortTest.TestAllPartialSort/SSE2  # GetParam() = 16384]=]  /root/repo/_dev/tests/sort_test [==[--gtest_filter=SortTestGroup/SortTest.TestAllPartialSort/SSE2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SortTestGroup/SortTest.TestAllPartialSort/SSE2  # GetParam() = 16384]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  sort_test_TESTS [==[SortTestGroup/SortTest.TestAllFloatLargerSmaller/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllFloatInf/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllMedian/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllBaseCase/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllPartition/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllGenerator/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllSort/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllVQSorter/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllParallelSort/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllArgSort/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllTopK/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllStableSort/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllSortNaN/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllUnique/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllSortBy/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllSortSegments/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllSortStrings/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllMerge/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllSelect/SSE2  # GetParam() = 16384]==] [==[SortTestGroup/SortTest.TestAllPartialSort/SSE2  # GetParam() = 16384]==])
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/sums_abs_diff_test[1]_tests.cmake")
+  include("/root/repo/_dev/sums_abs_diff_test[1]_tests.cmake")
+else()
+  add_test(sums_abs_diff_test_NOT_BUILT sums_abs_diff_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/swizzle_block_test[1]_tests.cmake")
+  include("/root/repo/_dev/swizzle_block_test[1]_tests.cmake")
+else()
+  add_test(swizzle_block_test_NOT_BUILT swizzle_block_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/swizzle_test[1]_tests.cmake")
+  include("/root/repo/_dev/swizzle_test[1]_tests.cmake")
+else()
+  add_test(swizzle_test_NOT_BUILT swizzle_test_NOT_BUILT)
+endif()
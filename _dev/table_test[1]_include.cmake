@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/table_test[1]_tests.cmake")
+  include("/root/repo/_dev/table_test[1]_tests.cmake")
+else()
+  add_test(table_test_NOT_BUILT table_test_NOT_BUILT)
+endif()
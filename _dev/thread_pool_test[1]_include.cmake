@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/thread_pool_test[1]_tests.cmake")
+  include("/root/repo/_dev/thread_pool_test[1]_tests.cmake")
+else()
+  add_test(thread_pool_test_NOT_BUILT thread_pool_test_NOT_BUILT)
+endif()
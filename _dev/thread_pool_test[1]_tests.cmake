@@ -0,0 +1,43 @@
+add_test([=[ThreadPoolTest.TestCoprime]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestCoprime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestCoprime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestRandomPermutation]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestRandomPermutation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestRandomPermutation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestMultiplePermutations]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestMultiplePermutations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestMultiplePermutations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestTasks]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestTasks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestTasks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestVictimLocality]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestVictimLocality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestVictimLocality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestStealCounts]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestStealCounts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestStealCounts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestChunks]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestRunChunks]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestRunChunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestRunChunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestDeprecated]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestDeprecated]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestDeprecated]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestPool]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestSmallAssignments]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestSmallAssignments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestSmallAssignments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestWaitMode]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestWaitMode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestWaitMode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestAdaptiveStats]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestAdaptiveStats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestAdaptiveStats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestCounter]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestCounter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestCounter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestNestedPools]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestNestedPools]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestNestedPools]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestNested]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestNested]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestNested]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestConcurrentSubmit]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestConcurrentSubmit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestConcurrentSubmit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestSubmit]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestSubmit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestSubmit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestRunStatic]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestRunStatic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestRunStatic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestParallelReduce]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestParallelReduce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestParallelReduce]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadPoolTest.TestAllocateForWorker]=]  /root/repo/_dev/tests/thread_pool_test [==[--gtest_filter=ThreadPoolTest.TestAllocateForWorker]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadPoolTest.TestAllocateForWorker]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  thread_pool_test_TESTS ThreadPoolTest.TestCoprime ThreadPoolTest.TestRandomPermutation ThreadPoolTest.TestMultiplePermutations ThreadPoolTest.TestTasks ThreadPoolTest.TestVictimLocality ThreadPoolTest.TestStealCounts ThreadPoolTest.TestChunks ThreadPoolTest.TestRunChunks ThreadPoolTest.TestDeprecated ThreadPoolTest.TestPool ThreadPoolTest.TestSmallAssignments ThreadPoolTest.TestWaitMode ThreadPoolTest.TestAdaptiveStats ThreadPoolTest.TestCounter ThreadPoolTest.TestNestedPools ThreadPoolTest.TestNested ThreadPoolTest.TestConcurrentSubmit ThreadPoolTest.TestSubmit ThreadPoolTest.TestRunStatic ThreadPoolTest.TestParallelReduce ThreadPoolTest.TestAllocateForWorker)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/topology_test[1]_tests.cmake")
+  include("/root/repo/_dev/topology_test[1]_tests.cmake")
+else()
+  add_test(topology_test_NOT_BUILT topology_test_NOT_BUILT)
+endif()
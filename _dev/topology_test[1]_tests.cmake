@@ -0,0 +1,9 @@
+add_test([=[TopologyTest.TestNum]=]  /root/repo/_dev/tests/topology_test [==[--gtest_filter=TopologyTest.TestNum]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopologyTest.TestNum]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TopologyTest.TestTopology]=]  /root/repo/_dev/tests/topology_test [==[--gtest_filter=TopologyTest.TestTopology]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopologyTest.TestTopology]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TopologyTest.TestUnknownPackages]=]  /root/repo/_dev/tests/topology_test [==[--gtest_filter=TopologyTest.TestUnknownPackages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopologyTest.TestUnknownPackages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TopologyTest.TestNuma]=]  /root/repo/_dev/tests/topology_test [==[--gtest_filter=TopologyTest.TestNuma]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TopologyTest.TestNuma]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dev SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  topology_test_TESTS TopologyTest.TestNum TopologyTest.TestTopology TopologyTest.TestUnknownPackages TopologyTest.TestNuma)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/truncate_test[1]_tests.cmake")
+  include("/root/repo/_dev/truncate_test[1]_tests.cmake")
+else()
+  add_test(truncate_test_NOT_BUILT truncate_test_NOT_BUILT)
+endif()
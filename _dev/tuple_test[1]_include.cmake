@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/tuple_test[1]_tests.cmake")
+  include("/root/repo/_dev/tuple_test[1]_tests.cmake")
+else()
+  add_test(tuple_test_NOT_BUILT tuple_test_NOT_BUILT)
+endif()
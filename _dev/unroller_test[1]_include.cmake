@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/unroller_test[1]_tests.cmake")
+  include("/root/repo/_dev/unroller_test[1]_tests.cmake")
+else()
+  add_test(unroller_test_NOT_BUILT unroller_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dev/widen_mul_test[1]_tests.cmake")
+  include("/root/repo/_dev/widen_mul_test[1]_tests.cmake")
+else()
+  add_test(widen_mul_test_NOT_BUILT widen_mul_test_NOT_BUILT)
+endif()
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <algorithm>   // std::sort, std::min, std::max
+#include <cmath>       // std::exp, std::log
 #include <functional>  // std::less, std::greater
 #include <vector>
 
@@ -104,12 +105,55 @@ HWY_POP_ATTRIBUTES
 
 namespace hwy {
 
-enum class Dist { kUniform8, kUniform16, kUniform32 };
+enum class Dist {
+  kUniform8,
+  kUniform16,
+  kUniform32,
+  // As kUniform32, but with lanes in ascending or descending order, or only
+  // the first 31/32 ascending as if further keys had been appended, or
+  // ascending except for a few keys that arrived later than their position.
+  kSorted,
+  kReversed,
+  kAppended,
+  kLateArrivals,
+  // Modeled on production data, see GenerateRealistic.
+  kZipf,
+  kNoisySorted,
+  kOrganPipe,
+  kSawtooth,
+  kDuplicatedRuns,
+  kTimestamps
+};
 
 static inline std::vector<Dist> AllDist() {
   return {/*Dist::kUniform8, Dist::kUniform16,*/ Dist::kUniform32};
 }
 
+// Inputs for which VQSort avoids most of the work.
+static inline std::vector<Dist> PresortedDist() {
+  return {Dist::kSorted, Dist::kReversed, Dist::kAppended,
+          Dist::kLateArrivals};
+}
+
+static inline std::vector<Dist> RealisticDist() {
+  return {Dist::kZipf,     Dist::kNoisySorted,     Dist::kOrganPipe,
+          Dist::kSawtooth, Dist::kDuplicatedRuns, Dist::kTimestamps};
+}
+
+static inline bool IsRealisticDist(Dist dist) {
+  switch (dist) {
+    case Dist::kZipf:
+    case Dist::kNoisySorted:
+    case Dist::kOrganPipe:
+    case Dist::kSawtooth:
+    case Dist::kDuplicatedRuns:
+    case Dist::kTimestamps:
+      return true;
+    default:
+      return false;
+  }
+}
+
 static inline const char* DistName(Dist dist) {
   switch (dist) {
     case Dist::kUniform8:
@@ -118,10 +162,166 @@ static inline const char* DistName(Dist dist) {
       return "uniform16";
     case Dist::kUniform32:
       return "uniform32";
+    case Dist::kSorted:
+      return "sorted";
+    case Dist::kReversed:
+      return "reversed";
+    case Dist::kAppended:
+      return "appended";
+    case Dist::kLateArrivals:
+      return "late";
+    case Dist::kZipf:
+      return "zipf";
+    case Dist::kNoisySorted:
+      return "noisy";
+    case Dist::kOrganPipe:
+      return "organpipe";
+    case Dist::kSawtooth:
+      return "sawtooth";
+    case Dist::kDuplicatedRuns:
+      return "dupruns";
+    case Dist::kTimestamps:
+      return "timestamps";
   }
   return "unreachable";
 }
 
+// SplitMix64. The RealisticDist inputs are generated with scalar code because
+// they have more complex structure and generating them is not timed.
+class ScalarRandom {
+ public:
+  explicit ScalarRandom(uint64_t seed) : state_(seed) {}
+
+  uint64_t operator()() {
+    uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  // Returns a value in [0, 1).
+  double Uniform() {
+    return static_cast<double>((*this)() >> 11) * (1.0 / (1ull << 53));
+  }
+
+ private:
+  uint64_t state_;
+};
+
+// Keys are derived from ranks such that their order matches, and distinct
+// ranks up to MaxRank result in distinct keys. Floating-point keys are in
+// [1, 2), which avoids denormals and NaN as in the other distributions.
+template <typename T, HWY_IF_NOT_FLOAT(T)>
+constexpr uint64_t MaxRank() {
+  // Not negative, so that signed keys are also ordered like ranks.
+  return static_cast<uint64_t>(LimitsMax<MakeSigned<T>>());
+}
+template <typename T, HWY_IF_FLOAT(T)>
+constexpr uint64_t MaxRank() {
+  return (1ull << MantissaBits<T>()) - 1;
+}
+
+template <typename T, HWY_IF_NOT_FLOAT(T)>
+T KeyFromRank(uint64_t rank) {
+  return static_cast<T>(rank);
+}
+template <typename T, HWY_IF_FLOAT(T)>
+T KeyFromRank(uint64_t rank) {
+  using TU = MakeUnsigned<T>;
+  const TU one = BitCastScalar<TU>(ConvertScalarTo<T>(1.0f));
+  return BitCastScalar<T>(static_cast<TU>(one | static_cast<TU>(rank)));
+}
+
+// Generates one of the RealisticDist into `v`, otherwise returns false. As in
+// GenerateInput, the values are generated per lane, which for 128-bit keys
+// results in similar patterns of keys.
+template <typename T>
+bool GenerateRealistic(const Dist dist, T* v, size_t num) {
+  if (num == 0 || !IsRealisticDist(dist)) return false;
+  ScalarRandom rng(0x5DEECE66Dull + num);
+  std::vector<uint64_t> ranks(num);
+  switch (dist) {
+    case Dist::kZipf: {
+      // Frequency of the i-th most common of 2^20 values is proportional to
+      // 1 / i. Multiplying with an odd constant permutes the values, so that
+      // the most common ones are scattered across the value range.
+      constexpr uint64_t kNumValues = 1ull << 20;
+      for (uint64_t& rank : ranks) {
+        const double log_max = std::log(static_cast<double>(kNumValues + 1));
+        const uint64_t i =
+            static_cast<uint64_t>(std::exp(rng.Uniform() * log_max)) - 1;
+        rank = (HWY_MIN(i, kNumValues - 1) * 0x9E3779B97F4A7C15ull) &
+               (kNumValues - 1);
+      }
+      break;
+    }
+    case Dist::kNoisySorted:
+      // Ascending, but keys are displaced by up to 64 positions.
+      for (size_t i = 0; i < num; ++i) {
+        ranks[i] = i + rng() % 64;
+      }
+      break;
+    case Dist::kOrganPipe:
+      // Ascending, then descending.
+      for (size_t i = 0; i < num; ++i) {
+        ranks[i] = HWY_MIN(i, num - 1 - i);
+      }
+      break;
+    case Dist::kSawtooth: {
+      // 32 ascending runs, more than HandlePresorted merges.
+      const size_t period = num / 32 + 1;
+      for (size_t i = 0; i < num; ++i) {
+        ranks[i] = i % period;
+      }
+      break;
+    }
+    case Dist::kDuplicatedRuns:
+      // Runs of 1 to 64 equal keys, e.g. after joining with duplicated rows.
+      for (size_t i = 0; i < num;) {
+        const size_t max_run = static_cast<size_t>(1 + rng() % 64);
+        const size_t run = HWY_MIN(max_run, num - i);
+        std::fill(ranks.data() + i, ranks.data() + i + run, rng());
+        i += run;
+      }
+      break;
+    case Dist::kTimestamps: {
+      // Microseconds since the Unix epoch of events with random gaps, in order
+      // of arrival: 1/32 of the events arrive after up to 1000 later ones.
+      uint64_t time = 1700000000ull * 1000000;
+      for (uint64_t& rank : ranks) {
+        time += 1 + rng() % 1000;
+        rank = time;
+      }
+      for (size_t i = 1; i < num; ++i) {
+        const uint64_t bits = rng();
+        if ((bits & 31) != 0) continue;
+        const size_t delay = 1 + (bits >> 5) % HWY_MIN(i, size_t{1000});
+        std::swap(ranks[i - delay], ranks[i]);
+      }
+      break;
+    }
+    default:
+      return false;
+  }
+
+  // If there are more ranks than distinct keys, map [min, max] to
+  // [0, MaxRank], which preserves their order but merges some ranks.
+  const uint64_t min = *std::min_element(ranks.begin(), ranks.end());
+  const uint64_t max = *std::max_element(ranks.begin(), ranks.end());
+  const bool scale = max > MaxRank<T>();
+  const double mul = static_cast<double>(MaxRank<T>()) /
+                     static_cast<double>(HWY_MAX(max - min, uint64_t{1}));
+  for (size_t i = 0; i < num; ++i) {
+    uint64_t rank = ranks[i];
+    if (scale) {
+      rank = static_cast<uint64_t>(static_cast<double>(rank - min) * mul);
+      rank = HWY_MIN(rank, MaxRank<T>());
+    }
+    v[i] = KeyFromRank<T>(rank);
+  }
+  return true;
+}
+
 template <typename T>
 class InputStats {
  public:
@@ -199,6 +399,7 @@ enum class Algo {
   kVQSort,
   kVQPartialSort,
   kVQSelect,
+  kRadix,
   kHeapSort,
   kHeapPartialSort,
   kHeapSelect,
@@ -242,6 +443,8 @@ static inline const char* AlgoName(Algo algo) {
     case Algo::kVQPartialSort:
     case Algo::kVQSelect:
       return "vq";
+    case Algo::kRadix:
+      return "radix";
     case Algo::kHeapSort:
     case Algo::kHeapPartialSort:
       return "heapsort";
@@ -263,6 +466,7 @@ static inline const char* AlgoName(Algo algo) {
 #endif
 
 #include "hwy/aligned_allocator.h"
+#include "hwy/contrib/sort/radix-inl.h"
 #include "hwy/contrib/sort/traits-inl.h"
 #include "hwy/contrib/sort/traits128-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"  // HeapSort
@@ -399,6 +603,27 @@ InputStats<T> GenerateInput(const Dist dist, T* v, size_t num) {
     CopyBytes(buf.get(), v + i, (num - i) * sizeof(T));
   }
 
+  // Sorting lanes also sorts 128-bit keys and key-value pairs, whose key is
+  // in the upper lane or bits. Round down to whole 128-bit keys.
+  if (dist == Dist::kSorted || dist == Dist::kAppended) {
+    const size_t num_sorted =
+        (dist == Dist::kSorted) ? num : (num - num / 32) & ~size_t{1};
+    std::sort(v, v + num_sorted);
+  } else if (dist == Dist::kReversed) {
+    std::sort(v, v + num, std::greater<T>());
+  } else if (dist == Dist::kLateArrivals) {
+    std::sort(v, v + num);
+    // Moves two lanes at a time from earlier to later positions.
+    constexpr size_t kNumLate = 8;
+    for (size_t k = 1; k <= kNumLate && num >= 4 * kNumLate; ++k) {
+      const size_t pos = (k * num / (kNumLate + 1)) & ~size_t{1};
+      const size_t from = (pos / 2) & ~size_t{1};
+      std::rotate(v + from, v + from + 2, v + pos + 2);
+    }
+  } else if (IsRealisticDist(dist)) {
+    (void)GenerateRealistic(dist, v, num);
+  }
+
   InputStats<T> input_stats;
   for (size_t i = 0; i < num; ++i) {
     input_stats.Notify(v[i]);
@@ -611,6 +836,20 @@ void CallHeapSort(K32V32* HWY_RESTRICT keys, const size_t num_keys) {
 
 #endif  // VQSORT_ENABLED
 
+// RadixSort only supports integer keys.
+template <class Order, typename KeyType, HWY_IF_INTEGER(KeyType),
+          HWY_IF_NOT_T_SIZE(KeyType, 1)>
+void CallRadixSort(KeyType* HWY_RESTRICT keys, const size_t num_keys) {
+  return RadixSort(keys, num_keys, Order());
+}
+
+template <class Order, typename KeyType,
+          hwy::EnableIf<!hwy::IsInteger<KeyType>() || sizeof(KeyType) == 1>* =
+              nullptr>
+void CallRadixSort(KeyType* HWY_RESTRICT, const size_t) {
+  HWY_ABORT("Radix sort requires 16-64 bit integer keys");
+}
+
 template <class Order, typename KeyType>
 void Run(Algo algo, KeyType* HWY_RESTRICT inout, size_t num,
          SharedState& shared, size_t /*thread*/, size_t k = 0) {
@@ -718,6 +957,9 @@ void Run(Algo algo, KeyType* HWY_RESTRICT inout, size_t num,
     case Algo::kVQSelect:
       return VQSelect(inout, num, k, Order());
 
+    case Algo::kRadix:
+      return CallRadixSort<Order>(inout, num);
+
     case Algo::kHeapSort:
       return CallHeapSort<Order>(inout, num);
 
@@ -34,6 +34,7 @@
 #include "hwy/timer-inl.h"
 #include "hwy/timer.h"
 #include "hwy/per_target.h"
+#include "hwy/profiler.h"
 // clang-format on
 
 #if HWY_OS_LINUX
@@ -51,6 +52,12 @@
 #define SORT_BENCH_BASE_AND_PARTITION (!SORT_ONLY_COLD && 0)
 #endif
 
+// For machine-readable results, define SORT_RESULT_FORMAT, see result-inl.h.
+// For the time spent in each phase of VQSort (presorted check, sampling,
+// partition, base case), build both this and the library with
+// -DPROFILER_ENABLED=1 and -DHWY_COMPILE_ONLY_STATIC=1, because the profiler
+// results are printed once and include all targets and key types.
+
 HWY_BEFORE_NAMESPACE();
 namespace hwy {
 // Defined within HWY_ONCE, used by BenchAllSort.
@@ -184,7 +191,7 @@ HWY_NOINLINE void BenchPartition() {
     }
 
     Result(Algo::kVQSort, dist, num_keys, 1, SummarizeMeasurements(seconds),
-           sizeof(KeyType), st.KeyString())
+           sizeof(KeyType), st.KeyString(), VarianceOfMeasurements(seconds))
         .Print();
   }
   HWY_ASSERT(sum != 999999);  // Prevent optimizing out
@@ -245,7 +252,7 @@ HWY_NOINLINE void BenchBase(std::vector<Result>& results) {
   HWY_ASSERT(sum < 1E99);
   results.emplace_back(Algo::kVQSort, dist, num_keys * kMul, 1,
                        SummarizeMeasurements(seconds), sizeof(KeyType),
-                       st.KeyString());
+                       st.KeyString(), VarianceOfMeasurements(seconds));
 }
 
 HWY_NOINLINE void BenchAllBase() {
@@ -300,6 +307,7 @@ std::vector<Algo> AlgoForBench() {
 
 #if VQSORT_ENABLED
         Algo::kVQSort,
+        Algo::kRadix,
 #endif
 #endif  // !HAVE_PARALLEL_IPS4O
   };
@@ -323,12 +331,17 @@ HWY_NOINLINE void BenchSort(size_t num_keys) {
     // Other algorithms don't depend on the vector instructions, so only run
     // them for the first target.
 #if !HAVE_VXSORT
-    if (algo != Algo::kVQSort && HWY_TARGET != first_sort_target) {
+    if (algo != Algo::kVQSort && algo != Algo::kRadix &&
+        HWY_TARGET != first_sort_target) {
       continue;
     }
 #endif
+    if (algo == Algo::kRadix && !IsInteger<KeyType>()) continue;
 
-    for (Dist dist : AllDist()) {
+    std::vector<Dist> dists = AllDist();
+    for (Dist dist : PresortedDist()) dists.push_back(dist);
+    for (Dist dist : RealisticDist()) dists.push_back(dist);
+    for (Dist dist : dists) {
       std::vector<double> seconds;
       for (size_t rep = 0; rep < reps; ++rep) {
         InputStats<LaneType> input_stats =
@@ -344,7 +357,7 @@ HWY_NOINLINE void BenchSort(size_t num_keys) {
             VerifySort(st, input_stats, aligned.get(), num_lanes, "BenchSort"));
       }
       Result(algo, dist, num_keys, 1, SummarizeMeasurements(seconds),
-             sizeof(KeyType), st.KeyString())
+             sizeof(KeyType), st.KeyString(), VarianceOfMeasurements(seconds))
           .Print();
     }  // dist
   }    // algo
@@ -447,6 +460,8 @@ HWY_NOINLINE void BenchAllSort() {
     BenchSort<Traits128<OrderAscendingKV128>>(num_keys);
 #endif
   }
+
+  PROFILER_PRINT_RESULTS();  // no-op unless PROFILER_ENABLED
 }
 
 }  // namespace
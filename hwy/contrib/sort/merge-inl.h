@@ -0,0 +1,299 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Merging of already sorted runs of keys, which is cheaper than sorting their
+// concatenation: each key is loaded and stored once per two-way merge.
+
+// Per-target
+// clang-format off
+#if defined(HIGHWAY_HWY_CONTRIB_SORT_MERGE_TOGGLE) == defined(HWY_TARGET_TOGGLE) // NOLINT
+// clang-format on
+#ifdef HIGHWAY_HWY_CONTRIB_SORT_MERGE_TOGGLE
+#undef HIGHWAY_HWY_CONTRIB_SORT_MERGE_TOGGLE
+#else
+#define HIGHWAY_HWY_CONTRIB_SORT_MERGE_TOGGLE
+#endif
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort-inl.h"  // KeyAdapter, FirstKeyAfter
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+#if VQSORT_ENABLED || HWY_IDE
+
+// Scalar merge for when `small` has only a few keys: binary-searches `large`
+// for the insertion point of each of them and copies the keys in between.
+// This is efficient regardless of the size of `large`.
+template <class Traits, typename T>
+HWY_NOINLINE void MergeSmall(Traits st, const T* HWY_RESTRICT small,
+                             size_t num_small, const T* HWY_RESTRICT large,
+                             size_t num_large, T* HWY_RESTRICT out) {
+  const size_t kLPK = st.LanesPerKey();
+  size_t pos = 0;
+  for (size_t i = 0; i < num_small; i += kLPK) {
+    const size_t next = FirstKeyAfter(st, small + i, large, pos, num_large);
+    CopyBytes(large + pos, out, (next - pos) * sizeof(T));
+    out += next - pos;
+    pos = next;
+    CopyBytes(small + i, out, kLPK * sizeof(T));
+    out += kLPK;
+  }
+  CopyBytes(large + pos, out, (num_large - pos) * sizeof(T));
+}
+
+// Sorts the bitonic sequence of keys in `v` via log2(keys) half-cleaner
+// stages, each of which compares keys whose index differs by `dist`.
+template <class D, class Traits, class V = Vec<D>>
+HWY_INLINE V SortBitonicVector(D d, Traits st, V v) {
+  const RebindToUnsigned<D> du;
+  using TU = TFromD<decltype(du)>;
+  const Vec<decltype(du)> iota = Iota(du, 0);
+  for (size_t dist = Lanes(d) / 2; dist >= st.LanesPerKey(); dist /= 2) {
+    const Vec<decltype(du)> vdist = Set(du, static_cast<TU>(dist));
+    const V partner =
+        TableLookupLanes(v, IndicesFromVec(d, Xor(iota, vdist)));
+    const Mask<D> is_lower = RebindMask(d, Eq(And(iota, vdist), Zero(du)));
+    v = IfThenElse(is_lower, st.First(d, v, partner), st.Last(d, v, partner));
+  }
+  return v;
+}
+
+// Bitonic merge of two sorted vectors: afterwards, `lo` holds the first half
+// of their keys and `hi` the second half, both sorted.
+template <class D, class Traits, class V = Vec<D>>
+HWY_INLINE void MergeVectors(D d, Traits st, V& lo, V& hi) {
+  // Concatenating a sorted and a reversed sorted vector is bitonic, hence so
+  // are the keywise first and last of the two.
+  hi = st.ReverseKeys(d, hi);
+  const V first = st.First(d, lo, hi);
+  const V last = st.Last(d, lo, hi);
+  lo = SortBitonicVector(d, st, first);
+  hi = SortBitonicVector(d, st, last);
+}
+
+// Merges the sorted lanes a[0, num_a) and b[0, num_b) into `out`, which must
+// not overlap either input. All counts are in lanes.
+template <class D, class Traits, typename T>
+HWY_NOINLINE void Merge2(D d, Traits st, const T* HWY_RESTRICT a,
+                         size_t num_a, const T* HWY_RESTRICT b, size_t num_b,
+                         T* HWY_RESTRICT out) {
+  using V = Vec<D>;
+  const size_t N = Lanes(d);
+  if (num_a < N || num_b < N) {
+    if (num_a <= num_b) return MergeSmall(st, a, num_a, b, num_b, out);
+    return MergeSmall(st, b, num_b, a, num_a, out);
+  }
+
+  // Loads the next vector from whichever input has the preceding first key.
+  // Because every key in `hi` follows all keys already written, this order
+  // ensures the lower half of each merge precedes all keys not yet loaded.
+  // The choice is data-dependent and unpredictable, hence branchless.
+  const auto load_next = [&]() HWY_ATTR {
+    const bool take_b = st.Compare1(b, a);
+    const T* HWY_RESTRICT from = take_b ? b : a;
+    const size_t step_a = take_b ? 0 : N;
+    a += step_a;
+    num_a -= step_a;
+    b += N - step_a;
+    num_b -= N - step_a;
+    return LoadU(d, from);
+  };
+
+  // As in BaseCase, the network compares all bits of key-value pairs so that
+  // values are not mixed with those of other items having the same key.
+  const typename Traits::SharedTraitsForSortingNetwork st_network;
+  V hi = load_next();
+  while (num_a >= N && num_b >= N) {
+    V lo = load_next();
+    MergeVectors(d, st_network, lo, hi);
+    StoreU(lo, d, out);
+    out += N;
+  }
+
+  // The remaining keys are those of `hi` and the inputs, one of which has
+  // fewer than N lanes. Merge those two small sets first, then the result
+  // with the other input, which may be large.
+  constexpr size_t kMaxLanes = HWY_MAX_LANES_D(D);
+  HWY_ALIGN T hi_buf[kMaxLanes];
+  HWY_ALIGN T small_buf[2 * kMaxLanes];
+  Store(hi, d, hi_buf);
+  const bool a_is_short = num_a < N;
+  const T* short_keys = a_is_short ? a : b;
+  const size_t num_short = a_is_short ? num_a : num_b;
+  MergeSmall(st, short_keys, num_short, hi_buf, N, small_buf);
+  MergeSmall(st, small_buf, N + num_short, a_is_short ? b : a,
+             a_is_short ? num_b : num_a, out);
+}
+
+// Merges `num_runs` sorted runs into `out` via a balanced tree of two-way
+// merges evaluated one level at a time, which requires a buffer of the total
+// size for more than two runs. Counts are in lanes.
+template <class D, class Traits, typename T>
+void MergeRuns(D d, Traits st, const T* const* runs, const size_t* num,
+               size_t num_runs, T* HWY_RESTRICT out) {
+  std::vector<const T*> inputs(runs, runs + num_runs);
+  std::vector<size_t> sizes(num, num + num_runs);
+  size_t total = 0;
+  for (size_t i = 0; i < num_runs; ++i) total += num[i];
+  if (num_runs <= 1) {
+    if (num_runs == 1) CopyBytes(runs[0], out, total * sizeof(T));
+    return;
+  }
+
+  // Alternate between `buf` and `out` such that the last level writes `out`.
+  const size_t levels = CeilLog2(num_runs);
+  AlignedFreeUniquePtr<T[]> buf;
+  if (levels > 1) {
+    buf = hwy::AllocateAligned<T>(total);
+    HWY_ASSERT(buf);
+  }
+  for (size_t level = 0; level < levels; ++level) {
+    T* HWY_RESTRICT dest = ((levels - 1 - level) & 1) ? buf.get() : out;
+    size_t pos = 0;
+    size_t num_outputs = 0;
+    for (size_t i = 0; i < num_runs; i += 2) {
+      size_t size = sizes[i];
+      if (i + 1 < num_runs) {
+        Merge2(d, st, inputs[i], sizes[i], inputs[i + 1], sizes[i + 1],
+               dest + pos);
+        size += sizes[i + 1];
+      } else {
+        CopyBytes(inputs[i], dest + pos, size * sizeof(T));
+      }
+      // Safe because num_outputs <= i.
+      inputs[num_outputs] = dest + pos;
+      sizes[num_outputs] = size;
+      ++num_outputs;
+      pos += size;
+    }
+    num_runs = num_outputs;
+  }
+}
+
+template <class Order, typename T>
+void MergeStatic(const T* HWY_RESTRICT a, size_t num_a,
+                 const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out) {
+  const SharedTraits<typename KeyAdapter<T>::template Traits<Order>> st;
+  using LaneType = typename decltype(st)::LaneType;
+  const SortTag<LaneType> d;
+  const size_t kLPK = st.LanesPerKey();
+  Merge2(d, st, reinterpret_cast<const LaneType*>(a), num_a * kLPK,
+         reinterpret_cast<const LaneType*>(b), num_b * kLPK,
+         reinterpret_cast<LaneType*>(out));
+}
+
+template <class Order, typename T>
+void MergeRunsStatic(const T* const* runs, const size_t* num, size_t num_runs,
+                     T* HWY_RESTRICT out) {
+  const SharedTraits<typename KeyAdapter<T>::template Traits<Order>> st;
+  using LaneType = typename decltype(st)::LaneType;
+  const SortTag<LaneType> d;
+  std::vector<size_t> num_lanes(num, num + num_runs);
+  for (size_t& n : num_lanes) n *= st.LanesPerKey();
+  MergeRuns(d, st, reinterpret_cast<const LaneType* const*>(runs),
+            num_lanes.data(), num_runs, reinterpret_cast<LaneType*>(out));
+}
+
+#endif  // VQSORT_ENABLED
+
+}  // namespace detail
+
+// Merges the sorted keys a[0, num_a) and b[0, num_b) into out[0, num_a +
+// num_b), which must not overlap the inputs. Both inputs must be sorted in
+// the given order, for example by VQSort, and must not contain NaN. The merge
+// is not stable. Supports the same key types as VQSortStatic.
+template <typename T>
+void VQMergeStatic(const T* HWY_RESTRICT a, size_t num_a,
+                   const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out,
+                   SortAscending) {
+#if VQSORT_ENABLED
+  using Order = typename detail::KeyAdapter<T>::Ascending;
+  detail::MergeStatic<Order>(a, num_a, b, num_b, out);
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif  // VQSORT_ENABLED
+}
+
+template <typename T>
+void VQMergeStatic(const T* HWY_RESTRICT a, size_t num_a,
+                   const T* HWY_RESTRICT b, size_t num_b, T* HWY_RESTRICT out,
+                   SortDescending) {
+#if VQSORT_ENABLED
+  using Order = typename detail::KeyAdapter<T>::Descending;
+  detail::MergeStatic<Order>(a, num_a, b, num_b, out);
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif  // VQSORT_ENABLED
+}
+
+// Merges `num_runs` sorted arrays, where runs[i] has num[i] keys, into `out`,
+// which must have room for all of them and not overlap the inputs. The same
+// requirements as for VQMergeStatic apply. Allocates a buffer of the total
+// size if there are more than two runs.
+template <typename T>
+void VQMergeRunsStatic(const T* const* runs, const size_t* num,
+                       size_t num_runs, T* HWY_RESTRICT out, SortAscending) {
+#if VQSORT_ENABLED
+  using Order = typename detail::KeyAdapter<T>::Ascending;
+  detail::MergeRunsStatic<Order>(runs, num, num_runs, out);
+#else
+  (void)runs;
+  (void)num;
+  (void)num_runs;
+  (void)out;
+  HWY_ASSERT(0);
+#endif  // VQSORT_ENABLED
+}
+
+template <typename T>
+void VQMergeRunsStatic(const T* const* runs, const size_t* num,
+                       size_t num_runs, T* HWY_RESTRICT out, SortDescending) {
+#if VQSORT_ENABLED
+  using Order = typename detail::KeyAdapter<T>::Descending;
+  detail::MergeRunsStatic<Order>(runs, num, num_runs, out);
+#else
+  (void)runs;
+  (void)num;
+  (void)num_runs;
+  (void)out;
+  HWY_ASSERT(0);
+#endif  // VQSORT_ENABLED
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_MERGE_TOGGLE
@@ -29,6 +29,14 @@ struct SortDescending {
   constexpr bool IsAscending() const { return false; }
 };
 
+// Treatment of NaN by the float and double VQSort overloads that take this
+// argument. kTotalOrder is IEEE 754 totalOrder: NaN with the sign bit set
+// precede -inf, other NaN follow +inf, and NaN payloads are retained. kFirst
+// and kLast place all NaN at the front or back of the output regardless of the
+// sort order, and replace them with the canonical NaN. In all modes, -0.0
+// precedes +0.0 in ascending order.
+enum class SortNaN { kTotalOrder, kFirst, kLast };
+
 }  // namespace hwy
 
 #endif  // HIGHWAY_HWY_CONTRIB_SORT_ORDER_H_
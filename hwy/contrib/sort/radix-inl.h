@@ -0,0 +1,327 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// LSD radix sort of integer keys. For large arrays of uniformly distributed
+// keys, this moves less data than VQSort because the number of passes depends
+// on the key size rather than log(n). Unlike VQSort, it requires a buffer of n
+// keys.
+
+// Normal include guard for target-independent parts
+#ifndef HIGHWAY_HWY_CONTRIB_SORT_RADIX_INL_H_
+#define HIGHWAY_HWY_CONTRIB_SORT_RADIX_INL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <utility>  // std::swap
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/cache_control.h"       // FlushStream
+#include "hwy/contrib/sort/vqsort.h"  // VQSort for small inputs
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+namespace hwy {
+
+struct RadixConstants {
+  // One pass per byte of the key.
+  static constexpr size_t kDigitBits = 8;
+  static constexpr size_t kBuckets = size_t{1} << kDigitBits;
+
+  // Each bucket has a write-combining buffer of one cache line, which is
+  // written to its destination with streaming stores once full.
+  static constexpr size_t kLineBytes = 64;
+
+  // Below this, the per-pass cost of prefix sums and buffer flushes dominates
+  // and VQSort is faster.
+  static constexpr size_t kMinKeys = 8192;
+
+  // The parallel mode hands each worker at least this many keys.
+  static constexpr size_t kMinKeysPerWorker = 64 * 1024;
+};
+
+}  // namespace hwy
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_RADIX_INL_H_
+
+// Per-target
+// clang-format off
+#if defined(HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE) == defined(HWY_TARGET_TOGGLE) // NOLINT
+// clang-format on
+#ifdef HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
+#undef HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
+#else
+#define HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
+#endif
+
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Xor-ing keys with this yields unsigned integers whose ascending order is the
+// `Order` of the keys.
+template <typename T, class Order>
+constexpr MakeUnsigned<T> RadixFlip() {
+  return static_cast<MakeUnsigned<T>>(
+      (IsSigned<T>() ? SignMask<T>() : 0) ^
+      (Order().IsAscending() ? 0 : LimitsMax<MakeUnsigned<T>>()));
+}
+
+// Histograms and write-combining buffers of one worker, which handles a
+// contiguous range of keys.
+template <typename T>
+class RadixWorker {
+  using TU = MakeUnsigned<T>;
+  static constexpr size_t kPasses = sizeof(T);
+  static constexpr size_t kBuckets = RadixConstants::kBuckets;
+  static constexpr size_t kLineLanes = RadixConstants::kLineBytes / sizeof(T);
+
+ public:
+  RadixWorker()
+      : lines_(AllocateAligned<T>(kBuckets * kLineLanes)),
+        bits_(AllocateAligned<TU>(Lanes(ScalableTag<TU>()))) {
+    HWY_ASSERT(lines_ && bits_);
+  }
+
+  // Histograms of all digits of keys[begin, end), obtained with a single read.
+  void CountAll(const T* HWY_RESTRICT keys, size_t begin, size_t end,
+                TU flip) {
+    ZeroBytes(counts_, sizeof(counts_));
+    const ScalableTag<TU> du;
+    const size_t N = Lanes(du);
+    const Vec<decltype(du)> vflip = Set(du, flip);
+    const TU* HWY_RESTRICT bits = reinterpret_cast<const TU*>(keys);
+    TU* HWY_RESTRICT flipped = bits_.get();
+
+    size_t i = begin;
+    for (; i + N <= end; i += N) {
+      Store(Xor(LoadU(du, bits + i), vflip), du, flipped);
+      for (size_t j = 0; j < N; ++j) {
+        CountDigits(flipped[j]);
+      }
+    }
+    for (; i < end; ++i) {
+      CountDigits(static_cast<TU>(bits[i] ^ flip));
+    }
+  }
+
+  // Histogram of the digit of keys[begin, end) used by `pass`.
+  void Count(const T* HWY_RESTRICT keys, size_t begin, size_t end, TU flip,
+             size_t pass) {
+    size_t* HWY_RESTRICT counts = counts_[pass];
+    ZeroBytes(counts, sizeof(counts_[pass]));
+    const size_t shift = pass * RadixConstants::kDigitBits;
+    const TU* HWY_RESTRICT bits = reinterpret_cast<const TU*>(keys);
+    for (size_t i = begin; i < end; ++i) {
+      ++counts[static_cast<TU>(bits[i] ^ flip) >> shift & (kBuckets - 1)];
+    }
+  }
+
+  size_t BucketCount(size_t pass, size_t bucket) const {
+    return counts_[pass][bucket];
+  }
+
+  // Index within the destination of the first key of `bucket` moved by this
+  // worker. Set before `Scatter`.
+  size_t& BucketBegin(size_t bucket) { return next_[bucket]; }
+
+  // Moves src[begin, end) to `dst`, grouped by their digit for `pass`. Keys
+  // are appended to the per-bucket write-combining buffer, which covers one
+  // cache line of `dst` and is written with whole-line streaming stores.
+  void Scatter(const T* HWY_RESTRICT src, size_t begin, size_t end, TU flip,
+               size_t pass, T* HWY_RESTRICT dst) {
+    const size_t shift = pass * RadixConstants::kDigitBits;
+    T* HWY_RESTRICT lines = lines_.get();
+
+    // The first line of each bucket begins at `first_`, which aligns all of
+    // the subsequent lines. `next_` is the index within `dst` corresponding to
+    // the start of the line, which may wrap around if dst is not aligned.
+    for (size_t b = 0; b < kBuckets; ++b) {
+      const uintptr_t addr = reinterpret_cast<uintptr_t>(dst + next_[b]);
+      first_[b] = (addr % RadixConstants::kLineBytes) / sizeof(T);
+      fill_[b] = first_[b];
+      next_[b] -= first_[b];
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+      const T key = src[i];
+      const size_t b =
+          static_cast<TU>(BitCastScalar<TU>(key) ^ flip) >> shift &
+          (kBuckets - 1);
+      lines[b * kLineLanes + fill_[b]] = key;
+      if (++fill_[b] == kLineLanes) {
+        FlushLine(b, dst);
+      }
+    }
+
+    for (size_t b = 0; b < kBuckets; ++b) {
+      CopyBytes(lines + b * kLineLanes + first_[b],
+                dst + (next_[b] + first_[b]),
+                (fill_[b] - first_[b]) * sizeof(T));
+    }
+    FlushStream();
+  }
+
+ private:
+  HWY_INLINE void CountDigits(TU bits) {
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+      ++counts_[pass][bits >> (pass * RadixConstants::kDigitBits) &
+                      (kBuckets - 1)];
+    }
+  }
+
+  HWY_INLINE void FlushLine(size_t b, T* HWY_RESTRICT dst) {
+    const T* HWY_RESTRICT line = lines_.get() + b * kLineLanes;
+    if (HWY_LIKELY(first_[b] == 0)) {
+      // Vectors are not larger than a line, so both are aligned.
+      const CappedTag<T, kLineLanes> d;
+      for (size_t i = 0; i < kLineLanes; i += Lanes(d)) {
+        Stream(Load(d, line + i), d, dst + next_[b] + i);
+      }
+    } else {
+      // Only part of the first line belongs to this bucket.
+      CopyBytes(line + first_[b], dst + (next_[b] + first_[b]),
+                (kLineLanes - first_[b]) * sizeof(T));
+      first_[b] = 0;
+    }
+    next_[b] += kLineLanes;
+    fill_[b] = 0;
+  }
+
+  size_t counts_[kPasses][kBuckets];
+  size_t next_[kBuckets];
+  size_t first_[kBuckets];
+  size_t fill_[kBuckets];
+  AlignedFreeUniquePtr<T[]> lines_;
+  AlignedFreeUniquePtr<TU[]> bits_;
+};
+
+// Calls `func(worker)` for each worker, concurrently if there are several.
+template <class Func>
+HWY_INLINE void ForEachRadixWorker(ThreadPool* pool, size_t num_workers,
+                                   const Func& func) {
+  if (num_workers == 1) return func(size_t{0});
+  pool->Run(0, num_workers, [&func](uint64_t task, size_t /*thread*/)
+                                HWY_ATTR { func(static_cast<size_t>(task)); });
+}
+
+// `pool` is only used if non-null.
+template <typename T, class Order>
+void RadixSort(T* HWY_RESTRICT keys, const size_t num, Order,
+               ThreadPool* pool) {
+  using TU = MakeUnsigned<T>;
+  constexpr size_t kPasses = sizeof(T);
+  constexpr size_t kBuckets = RadixConstants::kBuckets;
+  constexpr TU kFlip = RadixFlip<T, Order>();
+
+  const size_t num_workers =
+      pool ? HWY_MAX(size_t{1},
+                     HWY_MIN(pool->NumWorkers(),
+                             num / RadixConstants::kMinKeysPerWorker))
+           : 1;
+  std::vector<RadixWorker<T>> workers(num_workers);
+  // Worker w handles keys [begin(w), begin(w + 1)).
+  const auto begin = [num, num_workers](size_t w) {
+    return static_cast<size_t>(static_cast<uint64_t>(num) * w / num_workers);
+  };
+
+  AlignedFreeUniquePtr<T[]> buf = AllocateAligned<T>(num);
+  HWY_ASSERT(buf);
+
+  ForEachRadixWorker(pool, num_workers, [&](size_t w) HWY_ATTR {
+    workers[w].CountAll(keys, begin(w), begin(w + 1), kFlip);
+  });
+
+  // Passes in which all keys have the same digit would not change the order.
+  bool skip[kPasses];
+  for (size_t pass = 0; pass < kPasses; ++pass) {
+    skip[pass] = false;
+    for (size_t b = 0; b < kBuckets; ++b) {
+      size_t total = 0;
+      for (size_t w = 0; w < num_workers; ++w) {
+        total += workers[w].BucketCount(pass, b);
+      }
+      if (total == num) skip[pass] = true;
+      if (total != 0) break;
+    }
+  }
+
+  T* src = keys;
+  T* dst = buf.get();
+  bool moved = false;
+  for (size_t pass = 0; pass < kPasses; ++pass) {
+    if (skip[pass]) continue;
+    // After the first scatter, each worker's range holds different keys.
+    if (moved) {
+      ForEachRadixWorker(pool, num_workers, [&](size_t w) HWY_ATTR {
+        workers[w].Count(src, begin(w), begin(w + 1), kFlip, pass);
+      });
+    }
+
+    // Bucket-major, worker-minor order keeps the sort stable, which is
+    // required for preserving the order established by previous passes.
+    size_t sum = 0;
+    for (size_t b = 0; b < kBuckets; ++b) {
+      for (size_t w = 0; w < num_workers; ++w) {
+        workers[w].BucketBegin(b) = sum;
+        sum += workers[w].BucketCount(pass, b);
+      }
+    }
+
+    ForEachRadixWorker(pool, num_workers, [&](size_t w) HWY_ATTR {
+      workers[w].Scatter(src, begin(w), begin(w + 1), kFlip, pass, dst);
+    });
+    std::swap(src, dst);
+    moved = true;
+  }
+
+  if (src != keys) {
+    ForEachRadixWorker(pool, num_workers, [&](size_t w) HWY_ATTR {
+      CopyBytes(src + begin(w), keys + begin(w),
+                (begin(w + 1) - begin(w)) * sizeof(T));
+    });
+  }
+}
+
+}  // namespace detail
+
+// Sorts keys[0, n) of a 16, 32 or 64-bit integer type in the given `Order` via
+// LSD radix sort. Allocates a buffer of n keys. Small arrays are instead
+// sorted with VQSort.
+template <typename T, class Order, HWY_IF_INTEGER(T), HWY_IF_NOT_T_SIZE(T, 1)>
+void RadixSort(T* HWY_RESTRICT keys, const size_t num, Order order) {
+  if (num < RadixConstants::kMinKeys) return VQSort(keys, num, order);
+  detail::RadixSort(keys, num, order, nullptr);
+}
+
+// Same as above, but large arrays are split among the workers of `pool`. Must
+// not be called concurrently with other `pool.Run` unless the pool is in
+// concurrent mode.
+template <typename T, class Order, HWY_IF_INTEGER(T), HWY_IF_NOT_T_SIZE(T, 1)>
+void RadixSort(T* HWY_RESTRICT keys, const size_t num, Order order,
+               ThreadPool& pool) {
+  if (num < RadixConstants::kMinKeys) return VQSort(keys, num, order);
+  detail::RadixSort(keys, num, order, &pool);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_RADIX_TOGGLE
@@ -0,0 +1,130 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Conversion of keys to unsigned ranks whose ascending order matches the
+// requested order of the keys. Used by argsort and top-k, which pack ranks
+// together with indices.
+
+// Per-target
+// clang-format off
+#if defined(HIGHWAY_HWY_CONTRIB_SORT_RANK_TOGGLE) == defined(HWY_TARGET_TOGGLE) // NOLINT
+// clang-format on
+#ifdef HIGHWAY_HWY_CONTRIB_SORT_RANK_TOGGLE
+#undef HIGHWAY_HWY_CONTRIB_SORT_RANK_TOGGLE
+#else
+#define HIGHWAY_HWY_CONTRIB_SORT_RANK_TOGGLE
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/base.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Returns unsigned integers whose ascending order matches that of the keys
+// whose bits are `bits`.
+template <class DU>
+HWY_INLINE Vec<DU> AscendingRank(DU /* tag */, Vec<DU> bits,
+                                 hwy::UnsignedTag) {
+  return bits;
+}
+
+template <class DU>
+HWY_INLINE Vec<DU> AscendingRank(DU du, Vec<DU> bits, hwy::SignedTag) {
+  return Xor(bits, SignBit(du));
+}
+
+// -0.0 and +0.0 are equivalent. NaN are mapped to the maximum so that they are
+// sorted after all other keys, as in VQSort.
+template <class DU>
+HWY_INLINE Vec<DU> AscendingRank(DU du, Vec<DU> bits, hwy::FloatTag) {
+  using TF = FloatFromSize<sizeof(TFromD<DU>)>;
+  const RebindToSigned<DU> di;
+  const Vec<DU> sign = SignBit(du);
+  const Vec<DU> abs = AndNot(sign, bits);
+  // Negative: flip all bits so that larger magnitudes come first. Otherwise,
+  // set the sign bit so that the result is above all negative keys.
+  const Vec<DU> flip =
+      Or(BitCast(du, BroadcastSignBit(BitCast(di, bits))), sign);
+  const Vec<DU> rank = IfThenElse(Eq(abs, Zero(du)), sign, Xor(bits, flip));
+  return IfThenElse(Gt(abs, Set(du, ExponentMask<TF>())), Not(Zero(du)), rank);
+}
+
+template <class DU>
+HWY_INLINE Vec<DU> ReverseRank(DU /* tag */, Vec<DU> rank, hwy::NonFloatTag) {
+  return Not(rank);
+}
+
+// NaN remain the maximum.
+template <class DU>
+HWY_INLINE Vec<DU> ReverseRank(DU du, Vec<DU> rank, hwy::FloatTag) {
+  const Vec<DU> max = Not(Zero(du));
+  return IfThenElse(Eq(rank, max), max, Not(rank));
+}
+
+// Returns unsigned integers whose ascending order is the `Order` of the keys
+// of type `T` whose bits are `bits`.
+template <class Order, typename T, class DU>
+HWY_INLINE Vec<DU> KeyRank(DU du, Vec<DU> bits) {
+  const Vec<DU> rank = AscendingRank(du, bits, hwy::TypeTag<T>());
+  return Order().IsAscending() ? rank
+                               : ReverseRank(du, rank, hwy::IsFloatTag<T>());
+}
+
+template <class D64, class V, HWY_IF_T_SIZE_V(V, 4)>
+HWY_INLINE Vec<D64> WidenRank(D64 d64, V rank) {
+  return PromoteTo(d64, rank);
+}
+
+template <class D64, class V, HWY_IF_T_SIZE_V(V, 8)>
+HWY_INLINE Vec<D64> WidenRank(D64 /* tag */, V rank) {
+  return rank;
+}
+
+// Loads the bits of up to Lanes(d64) keys starting at `keys`.
+template <class D64, typename T>
+HWY_INLINE Vec<RebindToUnsigned<Rebind<T, D64>>> LoadKeyBits(
+    D64 d64, const T* HWY_RESTRICT keys, size_t remaining) {
+  const Rebind<T, D64> dk;
+  const RebindToUnsigned<decltype(dk)> du;
+  return BitCast(du, remaining >= Lanes(d64) ? LoadU(dk, keys)
+                                             : LoadN(dk, keys, remaining));
+}
+
+template <class D64>
+HWY_INLINE void StoreIndices(D64 d64, Vec<D64> idx,
+                             uint64_t* HWY_RESTRICT indices, size_t remaining) {
+  StoreN(idx, d64, indices, remaining);
+}
+
+template <class D64>
+HWY_INLINE void StoreIndices(D64 /* tag */, Vec<D64> idx,
+                             uint32_t* HWY_RESTRICT indices, size_t remaining) {
+  const Rebind<uint32_t, D64> d32;
+  StoreN(TruncateTo(d32, idx), d32, indices, remaining);
+}
+
+}  // namespace detail
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#endif  // HIGHWAY_HWY_CONTRIB_SORT_RANK_TOGGLE
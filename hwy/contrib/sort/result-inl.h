@@ -19,10 +19,12 @@
 #ifndef HIGHWAY_HWY_CONTRIB_SORT_RESULT_INL_H_
 #define HIGHWAY_HWY_CONTRIB_SORT_RESULT_INL_H_
 
+#include <stdio.h>
 #include <time.h>
 
 #include <algorithm>  // std::sort
 #include <string>
+#include <vector>
 
 #include "hwy/base.h"
 #include "hwy/nanobenchmark.h"
@@ -44,6 +46,40 @@ static inline double SummarizeMeasurements(std::vector<double>& seconds) {
   return sum / count;
 }
 
+// Returns the sample variance [s^2], which indicates whether the difference
+// between two configurations is significant.
+static inline double VarianceOfMeasurements(
+    const std::vector<double>& seconds) {
+  const size_t num = seconds.size();
+  if (num < 2) return 0.0;
+  double sum = 0.0;
+  for (double sec : seconds) sum += sec;
+  const double mean = sum / static_cast<double>(num);
+  double sum_sq = 0.0;
+  for (double sec : seconds) sum_sq += (sec - mean) * (sec - mean);
+  return sum_sq / static_cast<double>(num - 1);
+}
+
+// Format of Result::Print. CSV and JSON are intended for importing into a
+// database for A/B comparisons. To separate them from the test framework's
+// output, the CSV rows begin with "csv," and JSON is one object per line.
+#define SORT_RESULT_TEXT 0
+#define SORT_RESULT_CSV 1
+#define SORT_RESULT_JSON 2
+#ifndef SORT_RESULT_FORMAT
+#define SORT_RESULT_FORMAT SORT_RESULT_TEXT
+#endif
+
+// Prints the CSV header before the first row.
+static inline void MaybePrintCSVHeader() {
+  static bool printed = false;
+  if (printed) return;
+  printed = true;
+  printf(
+      "csv,target,algo,key,dist,num_keys,num_threads,sec,sec_variance,GBps,"
+      "cycles_per_key\n");
+}
+
 }  // namespace hwy
 #endif  // HIGHWAY_HWY_CONTRIB_SORT_RESULT_INL_H_
 
@@ -62,25 +98,60 @@ namespace HWY_NAMESPACE {
 
 struct Result {
   Result() {}
+  // `sec` is typically from SummarizeMeasurements and `sec_variance` from
+  // VarianceOfMeasurements.
   Result(const Algo algo, Dist dist, size_t num_keys, size_t num_threads,
-         double sec, size_t sizeof_key, const char* key_name)
+         double sec, size_t sizeof_key, const char* key_name,
+         double sec_variance = 0.0)
       : target(HWY_TARGET),
         algo(algo),
         dist(dist),
         num_keys(num_keys),
         num_threads(num_threads),
         sec(sec),
+        sec_variance(sec_variance),
         sizeof_key(sizeof_key),
         key_name(key_name) {}
 
-  void Print() const {
+  // Throughput of all threads.
+  double GBps() const {
     const double bytes = static_cast<double>(num_keys) *
                          static_cast<double>(num_threads) *
                          static_cast<double>(sizeof_key);
-    printf("%10s: %12s: %7s: %9s: %05g %4.0f MB/s (%2zu threads)\n",
-           hwy::TargetName(target), AlgoName(algo), key_name.c_str(),
-           DistName(dist), static_cast<double>(num_keys), bytes * 1E-6 / sec,
-           num_threads);
+    return bytes * 1E-9 / sec;
+  }
+
+  // Per thread, in units of the invariant timer, which usually counts at the
+  // nominal (not turbo) frequency.
+  double CyclesPerKey() const {
+    return sec * platform::InvariantTicksPerSecond() /
+           static_cast<double>(num_keys);
+  }
+
+  void Print() const {
+    const char* target_name = hwy::TargetName(target);
+    switch (SORT_RESULT_FORMAT) {
+      case SORT_RESULT_CSV:
+        MaybePrintCSVHeader();
+        printf("csv,%s,%s,%s,%s,%zu,%zu,%g,%g,%g,%g\n", target_name,
+               AlgoName(algo), key_name.c_str(), DistName(dist), num_keys,
+               num_threads, sec, sec_variance, GBps(), CyclesPerKey());
+        break;
+      case SORT_RESULT_JSON:
+        printf(
+            "{\"target\": \"%s\", \"algo\": \"%s\", \"key\": \"%s\", "
+            "\"dist\": \"%s\", \"num_keys\": %zu, \"num_threads\": %zu, "
+            "\"sec\": %g, \"sec_variance\": %g, \"GBps\": %g, "
+            "\"cycles_per_key\": %g}\n",
+            target_name, AlgoName(algo), key_name.c_str(), DistName(dist),
+            num_keys, num_threads, sec, sec_variance, GBps(), CyclesPerKey());
+        break;
+      default:
+        printf("%10s: %12s: %7s: %9s: %05g %4.0f MB/s (%2zu threads)\n",
+               target_name, AlgoName(algo), key_name.c_str(), DistName(dist),
+               static_cast<double>(num_keys), GBps() * 1E3, num_threads);
+        break;
+    }
   }
 
   int64_t target;
@@ -89,6 +160,7 @@ struct Result {
   size_t num_keys = 0;
   size_t num_threads = 0;
   double sec = 0.0;
+  double sec_variance = 0.0;
   size_t sizeof_key = 0;
   std::string key_name;
 };
@@ -57,6 +57,11 @@ struct SortConstants {
   // To change, must also update left + 3 * N etc. in the loop.
   static constexpr size_t kPartitionUnroll = 4;
 
+  // Parallel sorting hands each worker at least this many bytes of keys to
+  // partition, which amortizes the fork-join overhead. Subarrays smaller than
+  // twice this are sorted by a single worker.
+  static constexpr size_t kParallelChunkBytes = 64 * 1024;
+
   // Chunk := group of keys loaded for sampling a pivot. Matches the typical
   // cache line size of 64 bytes to get maximum benefit per L2 miss. Sort()
   // ensures vectors are no larger than that, so this can be independent of the
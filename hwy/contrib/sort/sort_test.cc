@@ -14,8 +14,13 @@
 // limitations under the License.
 
 #include <stdio.h>
+#include <string.h>
 
+#include <algorithm>
+#include <functional>  // std::greater
+#include <limits>
 #include <random>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -32,6 +37,8 @@
 #include "hwy/contrib/sort/traits128-inl.h"
 #include "hwy/contrib/sort/vqsort-inl.h"  // BaseCase
 #include "hwy/contrib/sort/vqsort.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
+#include "hwy/contrib/thread_pool/topology.h"  // HaveThreadingSupport
 #include "hwy/highway.h"
 #include "hwy/per_target.h"
 #include "hwy/tests/test_util-inl.h"
@@ -678,6 +685,7 @@ std::vector<Algo> SortAlgoForTest() {
 #endif
 #if VQSORT_ENABLED
         Algo::kVQSort,
+        Algo::kRadix,
 #endif
         Algo::kHeapSort,
   };
@@ -703,8 +711,12 @@ void TestSort(size_t num_lanes) {
   auto aligned =
       hwy::AllocateAligned<LaneType>(kMaxMisalign + num_lanes + kMaxMisalign);
   HWY_ASSERT(aligned);
+  std::vector<Dist> dists = AllDist();
+  for (Dist dist : PresortedDist()) dists.push_back(dist);
+  for (Dist dist : RealisticDist()) dists.push_back(dist);
   for (Algo algo : SortAlgoForTest()) {
-    for (Dist dist : AllDist()) {
+    if (algo == Algo::kRadix && !IsInteger<KeyType>()) continue;
+    for (Dist dist : dists) {
       for (size_t misalign : {size_t{0}, size_t{st.LanesPerKey()},
                               size_t{3 * st.LanesPerKey()}, kMaxMisalign / 2}) {
         LaneType* lanes = aligned.get() + misalign;
@@ -798,6 +810,773 @@ void TestAllSort() {
   }
 }
 
+// Small arrays, including those just above the base case, sorted repeatedly by
+// one VQSorter. Every other array is presorted to also exercise FindRuns.
+template <typename T, class Order>
+void TestVQSorter(RandomState& rng) {
+  const VQSorter<T, Order> sorter;
+  const bool ascending = Order().IsAscending();
+  std::vector<T> keys;
+  for (size_t num = 0; num < 600; num += 1 + num / 16) {
+    keys.resize(num);
+    for (T& key : keys) {
+      key = static_cast<T>(Random64(&rng) >> (num & 1 ? 60 : 0));
+    }
+    if (num & 2) std::sort(keys.begin(), keys.end());
+    std::vector<T> expected = keys;
+    if (ascending) {
+      std::sort(expected.begin(), expected.end());
+    } else {
+      std::sort(expected.begin(), expected.end(), std::greater<T>());
+    }
+
+    sorter(keys.data(), num);
+    HWY_ASSERT(keys == expected);
+  }
+}
+
+void TestAllVQSorter() {
+  RandomState rng;
+  TestVQSorter<uint16_t, SortDescending>(rng);
+  TestVQSorter<int32_t, SortAscending>(rng);
+  TestVQSorter<uint32_t, SortDescending>(rng);
+  TestVQSorter<int64_t, SortDescending>(rng);
+  TestVQSorter<uint64_t, SortAscending>(rng);
+  TestVQSorter<float, SortAscending>(rng);
+}
+
+template <class Traits>
+void TestParallelSort(ThreadPool& pool, Dist dist, size_t num_lanes) {
+// Workaround for stack overflow on clang-cl (/F 8388608 does not help).
+#if defined(_MSC_VER)
+  return;
+#endif
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto aligned = hwy::AllocateAligned<LaneType>(num_lanes);
+  HWY_ASSERT(aligned);
+  LaneType* lanes = aligned.get();
+  InputStats<LaneType> input_stats = GenerateInput(dist, lanes, num_lanes);
+
+  CompareResults<Traits> compare(lanes, num_lanes);
+  VQSort(HWY_RCAST_ALIGNED(KeyType*, lanes), num_keys, Order(), pool);
+  HWY_ASSERT(compare.Verify(lanes));
+  HWY_ASSERT(
+      VerifySort(st, input_stats, lanes, num_lanes, "TestParallelSort"));
+}
+
+// RadixSort has its own parallel mode.
+template <class Traits>
+void TestParallelRadixSort(ThreadPool& pool, Dist dist, size_t num_keys) {
+  using Order = typename Traits::Order;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+
+  auto aligned = hwy::AllocateAligned<KeyType>(num_keys);
+  HWY_ASSERT(aligned);
+  KeyType* keys = aligned.get();
+  InputStats<KeyType> input_stats = GenerateInput(dist, keys, num_keys);
+
+  CompareResults<Traits> compare(keys, num_keys);
+  RadixSort(keys, num_keys, Order(), pool);
+  HWY_ASSERT(compare.Verify(keys));
+  HWY_ASSERT(
+      VerifySort(st, input_stats, keys, num_keys, "TestParallelRadixSort"));
+}
+
+// Most keys are equal, so that the samples of most subarrays are all equal.
+template <class Traits>
+void TestParallelSortFewDistinct(ThreadPool& pool, size_t num_keys) {
+  using Order = typename Traits::Order;
+  using KeyType = typename Traits::KeyType;
+
+  std::mt19937 rng(123);
+  std::uniform_int_distribution<int> dist(0, 99);
+  std::vector<KeyType> keys(num_keys);
+  for (KeyType& key : keys) {
+    const int r = dist(rng);
+    key = static_cast<KeyType>(r < 90 ? 5 : r < 95 ? 3 : r == 95 ? 0 : 9);
+  }
+  std::vector<KeyType> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  if (!Order().IsAscending()) std::reverse(expected.begin(), expected.end());
+
+  VQSort(keys.data(), num_keys, Order(), pool);
+  HWY_ASSERT(keys == expected);
+}
+
+void TestAllParallelSort() {
+// TODO(b/314758657): Compiler bug causes incorrect results
+#ifndef VQSORT_DO_NOT_SKIP
+  if (HWY_COMPILER_CLANG && HWY_ARCH_X86 && HWY_TARGET >= HWY_SSSE3) {
+    return;
+  }
+#endif
+
+  ThreadPool pool(HaveThreadingSupport() ? 3 : 0);
+  // The larger size exceeds the threshold for partitioning in parallel.
+  for (size_t num : {size_t{3000}, AdjustedReps(size_t{300000})}) {
+    // uniform8 has many duplicates, which exercises the equal-samples path.
+    // Presorted inputs exercise the parallel sort of an unsorted suffix.
+    std::vector<Dist> dists = {Dist::kUniform8, Dist::kUniform32};
+    for (Dist dist : PresortedDist()) dists.push_back(dist);
+    for (Dist dist : dists) {
+      TestParallelSort<TraitsLane<OtherOrder<int32_t> > >(pool, dist, num);
+      TestParallelSort<TraitsLane<OrderAscending<uint64_t> > >(pool, dist,
+                                                               num);
+      TestParallelSort<TraitsLane<OrderAscending<float> > >(pool, dist, num);
+      TestParallelRadixSort<TraitsLane<OtherOrder<int32_t> > >(pool, dist,
+                                                               num);
+      TestParallelRadixSort<TraitsLane<OrderAscending<uint64_t> > >(pool, dist,
+                                                                    num);
+
+#if !HAVE_VXSORT && !HAVE_INTEL && VQSORT_ENABLED
+      TestParallelSort<Traits128<OrderAscending128> >(pool, dist, num);
+      TestParallelSort<TraitsLane<OrderDescendingKV64> >(pool, dist, num);
+#endif
+    }
+    TestParallelSortFewDistinct<TraitsLane<OrderAscending<uint32_t> > >(pool,
+                                                                        num);
+    TestParallelSortFewDistinct<TraitsLane<OtherOrder<int64_t> > >(pool, num);
+    TestParallelSortFewDistinct<TraitsLane<OrderAscending<float> > >(pool,
+                                                                     num);
+  }
+}
+
+// ------------------------------ ArgSort
+
+// Few distinct values, so that stability matters. Floats also include signed
+// zeros, infinities and NaN.
+template <typename T>
+T RandomArgSortKey(RandomState& rng, hwy::NonFloatTag) {
+  return static_cast<T>(static_cast<int>(Random32(&rng) % 64) - 32);
+}
+template <typename T>
+T RandomArgSortKey(RandomState& rng, hwy::FloatTag) {
+  const uint32_t bits = Random32(&rng);
+  switch (bits % 16) {
+    case 0:
+      return std::numeric_limits<T>::quiet_NaN();
+    case 1:
+      return -std::numeric_limits<T>::infinity();
+    case 2:
+      return static_cast<T>(-0.0);
+    default:
+      return static_cast<T>(static_cast<int>(bits % 64) - 32) / 4;
+  }
+}
+
+// NaN are after all other keys, regardless of the order.
+template <typename T>
+bool ArgSortLess(T a, T b, bool ascending, hwy::NonFloatTag) {
+  return ascending ? a < b : b < a;
+}
+template <typename T>
+bool ArgSortLess(T a, T b, bool ascending, hwy::FloatTag) {
+  if (ScalarIsNaN(a)) return false;
+  if (ScalarIsNaN(b)) return true;
+  return ascending ? a < b : b < a;
+}
+
+template <typename T, typename TI, class Order>
+void TestArgSort(RandomState& rng, size_t num) {
+  std::vector<T> keys(num);
+  for (T& key : keys) key = RandomArgSortKey<T>(rng, hwy::IsFloatTag<T>());
+  const std::vector<T> copy = keys;
+
+  std::vector<TI> expected(num);
+  for (size_t i = 0; i < num; ++i) expected[i] = static_cast<TI>(i);
+  std::stable_sort(expected.begin(), expected.end(), [&](TI a, TI b) {
+    return ArgSortLess(keys[a], keys[b], Order().IsAscending(),
+                       hwy::IsFloatTag<T>());
+  });
+
+  std::vector<TI> actual(num + 1, static_cast<TI>(12345));
+  VQArgSort(keys.data(), num, actual.data(), Order());
+  HWY_ASSERT(memcmp(keys.data(), copy.data(), num * sizeof(T)) == 0);
+  for (size_t i = 0; i < num; ++i) {
+    if (expected[i] != actual[i]) {
+      HWY_ABORT("%s %s: num %zu mismatch at %zu: %zu vs %zu\n",
+                hwy::TypeName(T(), 1).c_str(), hwy::TypeName(TI(), 1).c_str(),
+                num, i, static_cast<size_t>(expected[i]),
+                static_cast<size_t>(actual[i]));
+    }
+  }
+  HWY_ASSERT(actual[num] == static_cast<TI>(12345));  // no overrun
+}
+
+template <typename T>
+void TestArgSortAllIndices(RandomState& rng, size_t num) {
+  TestArgSort<T, uint32_t, SortAscending>(rng, num);
+  TestArgSort<T, uint32_t, SortDescending>(rng, num);
+  TestArgSort<T, uint64_t, SortAscending>(rng, num);
+  TestArgSort<T, uint64_t, SortDescending>(rng, num);
+}
+
+void TestAllArgSort() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    TestArgSortAllIndices<uint32_t>(rng, num);
+    TestArgSortAllIndices<int32_t>(rng, num);
+    TestArgSortAllIndices<float>(rng, num);
+    TestArgSortAllIndices<uint64_t>(rng, num);
+    TestArgSortAllIndices<int64_t>(rng, num);
+    TestArgSortAllIndices<double>(rng, num);
+  }
+}
+
+// ------------------------------ TopK
+
+template <typename T, typename TI, class Order>
+void TestTopK(RandomState& rng, size_t num, size_t k) {
+  std::vector<T> keys(num);
+  for (T& key : keys) key = RandomArgSortKey<T>(rng, hwy::IsFloatTag<T>());
+  const std::vector<T> copy = keys;
+
+  // Ties are broken by index, hence the first k of a stable argsort.
+  std::vector<TI> expected(num);
+  for (size_t i = 0; i < num; ++i) expected[i] = static_cast<TI>(i);
+  std::stable_sort(expected.begin(), expected.end(), [&](TI a, TI b) {
+    return ArgSortLess(keys[a], keys[b], Order().IsAscending(),
+                       hwy::IsFloatTag<T>());
+  });
+  const size_t num_out = HWY_MIN(k, num);
+
+  std::vector<T> out(num_out + 1);
+  std::vector<TI> indices(num_out + 1, static_cast<TI>(12345));
+  VQTopK(keys.data(), num, k, out.data(), indices.data(), Order());
+  HWY_ASSERT(memcmp(keys.data(), copy.data(), num * sizeof(T)) == 0);
+  HWY_ASSERT(indices[num_out] == static_cast<TI>(12345));  // no overrun
+  for (size_t i = 0; i < num_out; ++i) {
+    if (expected[i] != indices[i]) {
+      HWY_ABORT("%s %s: num %zu k %zu mismatch at %zu: %zu vs %zu\n",
+                hwy::TypeName(T(), 1).c_str(), hwy::TypeName(TI(), 1).c_str(),
+                num, k, i, static_cast<size_t>(expected[i]),
+                static_cast<size_t>(indices[i]));
+    }
+    HWY_ASSERT(memcmp(&out[i], &keys[expected[i]], sizeof(T)) == 0);
+  }
+
+  // Keys-only overload returns the same keys.
+  std::vector<T> out_keys(num_out + 1);
+  VQTopK(keys.data(), num, k, out_keys.data(), Order());
+  HWY_ASSERT(memcmp(out_keys.data(), out.data(), num_out * sizeof(T)) == 0);
+}
+
+template <typename T>
+void TestTopKAllIndices(RandomState& rng, size_t num) {
+  for (size_t k : {size_t{0}, size_t{1}, size_t{5}, num / 3, num + 1}) {
+    TestTopK<T, uint32_t, SortAscending>(rng, num, k);
+    TestTopK<T, uint32_t, SortDescending>(rng, num, k);
+    TestTopK<T, uint64_t, SortAscending>(rng, num, k);
+    TestTopK<T, uint64_t, SortDescending>(rng, num, k);
+  }
+}
+
+void TestAllTopK() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    TestTopKAllIndices<uint32_t>(rng, num);
+    TestTopKAllIndices<int32_t>(rng, num);
+    TestTopKAllIndices<float>(rng, num);
+    TestTopKAllIndices<uint64_t>(rng, num);
+    TestTopKAllIndices<int64_t>(rng, num);
+    TestTopKAllIndices<double>(rng, num);
+  }
+}
+
+template <class KV, class Order>
+void TestStableSort(RandomState& rng, size_t num) {
+  std::vector<KV> pairs(num);
+  for (size_t i = 0; i < num; ++i) {
+    pairs[i].key = Random32(&rng) % 64;
+    pairs[i].value = static_cast<decltype(pairs[i].value)>(i);
+  }
+  std::vector<KV> expected = pairs;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const KV& a, const KV& b) {
+                     return Order().IsAscending() ? a.key < b.key
+                                                  : b.key < a.key;
+                   });
+
+  VQStableSort(pairs.data(), num, Order());
+  for (size_t i = 0; i < num; ++i) {
+    if (expected[i].key != pairs[i].key ||
+        expected[i].value != pairs[i].value) {
+      HWY_ABORT("KV%zu num %zu mismatch at %zu: key %zu %zu value %zu %zu\n",
+                sizeof(KV) * 8, num, i, static_cast<size_t>(expected[i].key),
+                static_cast<size_t>(pairs[i].key),
+                static_cast<size_t>(expected[i].value),
+                static_cast<size_t>(pairs[i].value));
+    }
+  }
+}
+
+void TestAllStableSort() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    TestStableSort<K32V32, SortAscending>(rng, num);
+    TestStableSort<K32V32, SortDescending>(rng, num);
+    TestStableSort<K64V64, SortAscending>(rng, num);
+    TestStableSort<K64V64, SortDescending>(rng, num);
+  }
+}
+
+// ------------------------------ SortNaN
+
+// Includes NaN of both signs and with a payload, infinities and signed zeros.
+template <typename T>
+T RandomSortNaNKey(RandomState& rng) {
+  using TU = MakeUnsigned<T>;
+  const uint32_t bits = Random32(&rng);
+  switch (bits % 16) {
+    case 0:
+      return std::numeric_limits<T>::quiet_NaN();
+    case 1:
+      return -std::numeric_limits<T>::quiet_NaN();
+    case 2:
+      return BitCastScalar<T>(static_cast<TU>(
+          BitCastScalar<TU>(std::numeric_limits<T>::quiet_NaN()) | 5));
+    case 3:
+      return std::numeric_limits<T>::infinity();
+    case 4:
+      return -std::numeric_limits<T>::infinity();
+    case 5:
+      return static_cast<T>(-0.0);
+    case 6:
+      return static_cast<T>(0.0);
+    default:
+      return static_cast<T>(static_cast<int>(bits % 64) - 32) / 4;
+  }
+}
+
+// IEEE 754 totalOrder: negative sign first, then by magnitude, which for NaN
+// is the payload.
+template <typename T>
+bool TotalOrderLess(T a, T b) {
+  using TU = MakeUnsigned<T>;
+  const TU bits_a = BitCastScalar<TU>(a);
+  const TU bits_b = BitCastScalar<TU>(b);
+  const bool neg_a = (bits_a & SignMask<T>()) != 0;
+  const bool neg_b = (bits_b & SignMask<T>()) != 0;
+  if (neg_a != neg_b) return neg_a;
+  const TU mag_a = static_cast<TU>(bits_a & ~SignMask<T>());
+  const TU mag_b = static_cast<TU>(bits_b & ~SignMask<T>());
+  return neg_a ? mag_b < mag_a : mag_a < mag_b;
+}
+
+template <typename T, class Order>
+void TestSortNaN(RandomState& rng, SortNaN nan, size_t num) {
+  std::vector<T> keys(num);
+  for (T& key : keys) key = RandomSortNaNKey<T>(rng);
+
+  std::vector<T> expected = keys;
+  const bool ascending = Order().IsAscending();
+  std::sort(expected.begin(), expected.end(), [&](T a, T b) {
+    if (nan != SortNaN::kTotalOrder) {
+      const bool nan_a = ScalarIsNaN(a);
+      const bool nan_b = ScalarIsNaN(b);
+      if (nan_a || nan_b) {
+        return nan_a != nan_b && nan_a == (nan == SortNaN::kFirst);
+      }
+    }
+    return ascending ? TotalOrderLess(a, b) : TotalOrderLess(b, a);
+  });
+  if (nan != SortNaN::kTotalOrder) {
+    // Expect the canonical NaN, as in VQSort.
+    const T canonical_nan = BitCastScalar<T>(LimitsMax<MakeSigned<T>>());
+    for (T& key : expected) {
+      if (ScalarIsNaN(key)) key = canonical_nan;
+    }
+  }
+
+  VQSort(keys.data(), num, Order(), nan);
+  for (size_t i = 0; i < num; ++i) {
+    if (memcmp(&keys[i], &expected[i], sizeof(T)) != 0) {
+      HWY_ABORT("%s asc %d nan %d: num %zu mismatch at %zu: %f vs %f\n",
+                hwy::TypeName(T(), 1).c_str(), ascending,
+                static_cast<int>(nan), num, i,
+                static_cast<double>(expected[i]), static_cast<double>(keys[i]));
+    }
+  }
+}
+
+template <typename T>
+void TestSortNaNAllModes(RandomState& rng, size_t num) {
+  for (SortNaN nan : {SortNaN::kTotalOrder, SortNaN::kFirst, SortNaN::kLast}) {
+    TestSortNaN<T, SortAscending>(rng, nan, num);
+    TestSortNaN<T, SortDescending>(rng, nan, num);
+  }
+}
+
+void TestAllSortNaN() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    TestSortNaNAllModes<float>(rng, num);
+    TestSortNaNAllModes<double>(rng, num);
+  }
+}
+
+// ------------------------------ Unique
+
+template <typename T>
+bool SameUniqueKey(T a, T b, hwy::NonFloatTag) {
+  return a == b;
+}
+template <typename T>
+bool SameUniqueKey(T a, T b, hwy::FloatTag) {
+  return a == b || (ScalarIsNaN(a) && ScalarIsNaN(b));
+}
+template <typename T>
+bool SameUniqueKey(T a, T b) {
+  return SameUniqueKey(a, b, hwy::IsFloatTag<T>());
+}
+
+// Runs of equal keys, sorted or not, including -0.0/+0.0 and NaN for floats.
+template <typename T>
+void TestUnique(RandomState& rng, size_t num, bool sort) {
+  std::vector<T> keys(num);
+  for (T& key : keys) key = RandomArgSortKey<T>(rng, hwy::IsFloatTag<T>());
+  // Lengthen the runs if not sorting.
+  for (size_t i = 1; i < num; ++i) {
+    if (Random32(&rng) % 4 != 0) keys[i] = keys[i - 1];
+  }
+  if (sort) VQSort(keys.data(), num, SortAscending());
+
+  std::vector<T> expected;
+  std::vector<uint64_t> expected_counts;
+  for (size_t i = 0; i < num; ++i) {
+    if (i != 0 && SameUniqueKey(keys[i], keys[i - 1])) {
+      ++expected_counts.back();
+    } else {
+      expected.push_back(keys[i]);
+      expected_counts.push_back(1);
+    }
+  }
+  const size_t num_unique = expected.size();
+
+  // Separate outputs, then in-place.
+  std::vector<T> unique(num);
+  std::vector<uint64_t> counts(num);
+  HWY_ASSERT_EQ(num_unique, VQUniqueCounts(keys.data(), num, unique.data(),
+                                           counts.data()));
+  HWY_ASSERT(memcmp(unique.data(), expected.data(), num_unique * sizeof(T)) ==
+             0);
+  for (size_t i = 0; i < num_unique; ++i) {
+    HWY_ASSERT_EQ(expected_counts[i], counts[i]);
+  }
+
+  std::vector<T> copy = keys;
+  HWY_ASSERT_EQ(num_unique, VQUniqueCounts(copy.data(), num, copy.data(),
+                                           counts.data()));
+  HWY_ASSERT(memcmp(copy.data(), expected.data(), num_unique * sizeof(T)) ==
+             0);
+
+  HWY_ASSERT_EQ(num_unique, VQUnique(keys.data(), num));
+  HWY_ASSERT(memcmp(keys.data(), expected.data(), num_unique * sizeof(T)) ==
+             0);
+}
+
+template <typename T>
+void TestSortUnique(RandomState& rng, size_t num) {
+  std::vector<T> keys(num);
+  for (T& key : keys) key = RandomArgSortKey<T>(rng, hwy::IsFloatTag<T>());
+  std::vector<T> expected = keys;
+  VQSort(expected.data(), num, SortDescending());
+  expected.erase(std::unique(expected.begin(), expected.end(),
+                             [](T a, T b) { return SameUniqueKey(a, b); }),
+                 expected.end());
+  const size_t num_unique = VQSortUnique(keys.data(), num, SortDescending());
+  HWY_ASSERT_EQ(expected.size(), num_unique);
+  for (size_t i = 0; i < num_unique; ++i) {
+    HWY_ASSERT(SameUniqueKey(expected[i], keys[i]));
+  }
+}
+
+template <typename T>
+void TestUniqueAll(RandomState& rng, size_t num) {
+  TestUnique<T>(rng, num, /*sort=*/false);
+  TestUnique<T>(rng, num, /*sort=*/true);
+  TestSortUnique<T>(rng, num);
+}
+
+void TestAllUnique() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{2}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    TestUniqueAll<uint32_t>(rng, num);
+    TestUniqueAll<int32_t>(rng, num);
+    TestUniqueAll<float>(rng, num);
+    TestUniqueAll<uint64_t>(rng, num);
+    TestUniqueAll<int64_t>(rng, num);
+    TestUniqueAll<double>(rng, num);
+  }
+}
+
+// ------------------------------ SortBy
+
+// Each record also stores its original index, so that comparing the records
+// also verifies stability.
+template <typename T, class Order>
+void TestSortBy(RandomState& rng, SortKeyType key_type, size_t record_bytes,
+                size_t key_offset, size_t num) {
+  const size_t index_offset =
+      key_offset >= sizeof(uint32_t) ? 0 : record_bytes - sizeof(uint32_t);
+  HWY_ASSERT(index_offset == 0 ||
+             key_offset + sizeof(T) <= record_bytes - sizeof(uint32_t));
+
+  std::vector<uint8_t> records(num * record_bytes);
+  for (uint8_t& byte : records) byte = static_cast<uint8_t>(Random32(&rng));
+  std::vector<T> keys(num);
+  for (size_t i = 0; i < num; ++i) {
+    keys[i] = RandomArgSortKey<T>(rng, hwy::IsFloatTag<T>());
+    const uint32_t index = static_cast<uint32_t>(i);
+    uint8_t* record = records.data() + i * record_bytes;
+    CopyBytes<sizeof(T)>(&keys[i], record + key_offset);
+    CopyBytes<sizeof(index)>(&index, record + index_offset);
+  }
+  const std::vector<uint8_t> copy = records;
+
+  std::vector<size_t> expected(num);
+  for (size_t i = 0; i < num; ++i) expected[i] = i;
+  std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) {
+    return ArgSortLess(keys[a], keys[b], Order().IsAscending(),
+                       hwy::IsFloatTag<T>());
+  });
+
+  VQSortBy(records.data(), num, record_bytes, key_offset, key_type, Order());
+  for (size_t i = 0; i < num; ++i) {
+    if (memcmp(records.data() + i * record_bytes,
+               copy.data() + expected[i] * record_bytes, record_bytes) != 0) {
+      HWY_ABORT("%s record_bytes %zu offset %zu num %zu mismatch at %zu\n",
+                hwy::TypeName(T(), 1).c_str(), record_bytes, key_offset, num,
+                i);
+    }
+  }
+}
+
+template <typename T>
+void TestSortByBothOrders(RandomState& rng, SortKeyType key_type,
+                          size_t record_bytes, size_t key_offset, size_t num) {
+  TestSortBy<T, SortAscending>(rng, key_type, record_bytes, key_offset, num);
+  TestSortBy<T, SortDescending>(rng, key_type, record_bytes, key_offset, num);
+}
+
+void TestAllSortBy() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    // Record sizes with and without a specialized copy, and keys at
+    // unaligned offsets.
+    TestSortByBothOrders<uint32_t>(rng, SortKeyType::kU32, 8, 4, num);
+    TestSortByBothOrders<int32_t>(rng, SortKeyType::kI32, 20, 9, num);
+    TestSortByBothOrders<float>(rng, SortKeyType::kF32, 24, 0, num);
+    TestSortByBothOrders<uint64_t>(rng, SortKeyType::kU64, 16, 8, num);
+    TestSortByBothOrders<int64_t>(rng, SortKeyType::kI64, 64, 40, num);
+    TestSortByBothOrders<double>(rng, SortKeyType::kF64, 100, 3, num);
+  }
+}
+
+// ------------------------------ SortSegments
+
+template <typename T, class Order>
+void TestSortSegments(RandomState& rng, ThreadPool* pool) {
+  // Mostly small segments, including empty ones, plus some larger than the
+  // base case.
+  const size_t num_segments = AdjustedReps(2000);
+  std::vector<size_t> offsets = {0};
+  for (size_t i = 0; i < num_segments; ++i) {
+    const uint32_t bits = Random32(&rng);
+    const size_t size = (bits % 32 == 0) ? bits % 2000 : bits % 300;
+    offsets.push_back(offsets.back() + size);
+  }
+  const size_t num = offsets.back();
+  std::vector<T> keys(num);
+  for (T& key : keys) key = RandomArgSortKey<T>(rng, hwy::IsFloatTag<T>());
+
+  std::vector<T> expected = keys;
+  for (size_t i = 0; i < num_segments; ++i) {
+    if (offsets[i] != offsets[i + 1]) {
+      VQSort(expected.data() + offsets[i], offsets[i + 1] - offsets[i],
+             Order());
+    }
+  }
+
+  if (pool) {
+    VQSortSegments(keys.data(), offsets.data(), num_segments, Order(), *pool);
+  } else {
+    VQSortSegments(keys.data(), offsets.data(), num_segments, Order());
+  }
+  // Bitwise comparison because NaN != NaN.
+  for (size_t i = 0; i < num; ++i) {
+    if (memcmp(&keys[i], &expected[i], sizeof(T)) != 0) {
+      HWY_ABORT("%s asc %d: num %zu mismatch at %zu\n",
+                hwy::TypeName(T(), 1).c_str(), Order().IsAscending(), num, i);
+    }
+  }
+}
+
+template <typename T>
+void TestSortSegmentsBothOrders(RandomState& rng, ThreadPool* pool) {
+  TestSortSegments<T, SortAscending>(rng, pool);
+  TestSortSegments<T, SortDescending>(rng, pool);
+}
+
+void TestAllSortSegments() {
+  RandomState rng;
+  ThreadPool pool(HaveThreadingSupport() ? 3 : 0);
+  for (ThreadPool* p : {static_cast<ThreadPool*>(nullptr), &pool}) {
+    TestSortSegmentsBothOrders<uint32_t>(rng, p);
+    TestSortSegmentsBothOrders<int32_t>(rng, p);
+    TestSortSegmentsBothOrders<float>(rng, p);
+    TestSortSegmentsBothOrders<uint64_t>(rng, p);
+    TestSortSegmentsBothOrders<int64_t>(rng, p);
+    TestSortSegmentsBothOrders<double>(rng, p);
+  }
+}
+
+// ------------------------------ SortStrings
+
+// Strings from a small alphabet with long shared prefixes, so that groups of
+// equal 8-byte prefixes are common, plus strings that are prefixes of others,
+// including those ending in zero bytes, which match the padding.
+std::string RandomSortString(RandomState& rng) {
+  static const char* kPrefixes[4] = {"", "https://www.example.com/",
+                                     "https://www.example.com/a/b/", "ab"};
+  const uint32_t bits = Random32(&rng);
+  std::string s = kPrefixes[bits % 4];
+  const size_t len = (bits >> 2) % 24;
+  for (size_t i = 0; i < len; ++i) {
+    s.push_back(static_cast<char>("\0abz\xff"[Random32(&rng) % 5]));
+  }
+  return s;
+}
+
+void TestSortStrings(RandomState& rng, size_t num) {
+  std::vector<std::string> storage(num);
+  for (std::string& s : storage) s = RandomSortString(rng);
+  std::vector<SortString> strings(num);
+  for (size_t i = 0; i < num; ++i) {
+    strings[i].data = reinterpret_cast<const uint8_t*>(storage[i].data());
+    strings[i].size = storage[i].size();
+  }
+  // std::string compares chars as unsigned, like memcmp.
+  std::vector<std::string> expected = storage;
+  std::sort(expected.begin(), expected.end());
+
+  for (bool ascending : {true, false}) {
+    std::vector<SortString> actual = strings;
+    if (ascending) {
+      VQSortStrings(actual.data(), num, SortAscending());
+    } else {
+      VQSortStrings(actual.data(), num, SortDescending());
+    }
+    for (size_t i = 0; i < num; ++i) {
+      const std::string& e = expected[ascending ? i : num - 1 - i];
+      const std::string a(reinterpret_cast<const char*>(actual[i].data),
+                          actual[i].size);
+      if (e != a) {
+        HWY_ABORT("num %zu asc %d mismatch at %zu: sizes %zu vs %zu\n", num,
+                  ascending, i, e.size(), a.size());
+      }
+    }
+  }
+}
+
+void TestAllSortStrings() {
+  RandomState rng;
+  for (size_t num : {size_t{0}, size_t{1}, size_t{7}, size_t{1000},
+                     AdjustedReps(size_t{30000})}) {
+    TestSortStrings(rng, num);
+  }
+}
+
+// ------------------------------ Merge
+
+// Splits the input into `num_runs` runs of random size, sorts each with
+// VQSort, and merges them.
+template <class Traits>
+void TestMerge(RandomState& rng, Dist dist, size_t num_runs, size_t num_lanes) {
+  using Order = typename Traits::Order;
+  using LaneType = typename Traits::LaneType;
+  using KeyType = typename Traits::KeyType;
+  SharedTraits<Traits> st;
+
+  // Round up to a whole number of keys.
+  num_lanes += (st.Is128() && (num_lanes & 1));
+  const size_t num_keys = num_lanes / st.LanesPerKey();
+
+  auto aligned = hwy::AllocateAligned<LaneType>(num_lanes);
+  // One extra key to detect overruns.
+  auto merged = hwy::AllocateAligned<LaneType>(num_lanes + st.LanesPerKey());
+  HWY_ASSERT(aligned && merged);
+  InputStats<LaneType> input_stats =
+      GenerateInput(dist, aligned.get(), num_lanes);
+  CompareResults<Traits> compare(aligned.get(), num_lanes);
+
+  KeyType* keys = HWY_RCAST_ALIGNED(KeyType*, aligned.get());
+  std::vector<const KeyType*> runs(num_runs);
+  std::vector<size_t> num(num_runs);
+  size_t begin = 0;
+  for (size_t i = 0; i < num_runs; ++i) {
+    const size_t remaining = num_keys - begin;
+    num[i] = (i == num_runs - 1) ? remaining : Random32(&rng) % (remaining + 1);
+    VQSort(keys + begin, num[i], Order());
+    runs[i] = keys + begin;
+    begin += num[i];
+  }
+
+  for (size_t i = 0; i < st.LanesPerKey(); ++i) {
+    merged[num_lanes + i] = hwy::HighestValue<LaneType>();
+  }
+  KeyType* out = HWY_RCAST_ALIGNED(KeyType*, merged.get());
+  if (num_runs == 2) {
+    VQMerge(runs[0], num[0], runs[1], num[1], out, Order());
+  } else {
+    VQMergeRuns(runs.data(), num.data(), num_runs, out, Order());
+  }
+  HWY_ASSERT(compare.Verify(merged.get()));
+  HWY_ASSERT(
+      VerifySort(st, input_stats, merged.get(), num_lanes, "TestMerge"));
+  for (size_t i = 0; i < st.LanesPerKey(); ++i) {
+    HWY_ASSERT(merged[num_lanes + i] == hwy::HighestValue<LaneType>());
+  }
+}
+
+void TestAllMerge() {
+  RandomState rng;
+  for (size_t num_runs : {size_t{1}, size_t{2}, size_t{3}, size_t{8}}) {
+    for (size_t num : {size_t{1}, size_t{100}, AdjustedReps(size_t{20000})}) {
+      // uniform8 has many duplicates, including across runs.
+      for (Dist dist : {Dist::kUniform8, Dist::kUniform32}) {
+        TestMerge<TraitsLane<OtherOrder<int32_t> > >(rng, dist, num_runs, num);
+        TestMerge<TraitsLane<OtherOrder<uint16_t> > >(rng, dist, num_runs, num);
+        TestMerge<TraitsLane<OrderAscending<uint64_t> > >(rng, dist, num_runs,
+                                                          num);
+        TestMerge<TraitsLane<OrderAscending<float> > >(rng, dist, num_runs,
+                                                       num);
+
+#if !HAVE_VXSORT && !HAVE_INTEL && VQSORT_ENABLED
+        TestMerge<Traits128<OrderAscending128> >(rng, dist, num_runs, num);
+        TestMerge<Traits128<OrderDescendingKV128> >(rng, dist, num_runs, num);
+        TestMerge<TraitsLane<OrderAscendingKV64> >(rng, dist, num_runs, num);
+#endif
+      }
+    }
+  }
+}
+
 std::vector<Algo> PartialSortAlgoForTest() {
   return {
 #if VQSORT_ENABLED
@@ -1055,6 +1834,17 @@ HWY_EXPORT_AND_TEST_P(SortTest, TestAllBaseCase);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllPartition);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllGenerator);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllVQSorter);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllParallelSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllArgSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllTopK);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllStableSort);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortNaN);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllUnique);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortBy);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortSegments);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllSortStrings);
+HWY_EXPORT_AND_TEST_P(SortTest, TestAllMerge);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllSelect);
 HWY_EXPORT_AND_TEST_P(SortTest, TestAllPartialSort);
 HWY_AFTER_TEST();
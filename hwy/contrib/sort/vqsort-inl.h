@@ -22,13 +22,19 @@
 #include <stdio.h>
 #include <time.h>  // clock
 
+#include <algorithm>  // std::rotate
+#include <vector>
+
 // IWYU pragma: begin_exports
 #include "hwy/base.h"
 #include "hwy/contrib/sort/order.h"  // SortAscending
 // IWYU pragma: end_exports
 
 #include "hwy/cache_control.h"  // Prefetch
-#include "hwy/print.h"          // unconditional, see above.
+#include "hwy/contrib/thread_pool/thread_pool.h"
+#include "hwy/print.h"     // unconditional, see above.
+#include "hwy/profiler.h"  // PROFILER_ZONE
+#include "hwy/targets.h"   // GetChosenTarget
 
 // If 1, VQSortStatic can be called without including vqsort.h, and we avoid
 // any DLLEXPORT. This simplifies integration into other build systems, but
@@ -77,6 +83,15 @@ HWY_INLINE uint64_t* GetGeneratorStateStatic() {
   return state;
 }
 
+// Ensures HWY_DYNAMIC_POINTER returns the function for the best target, rather
+// than the initial table entry, which chooses the target on every call.
+HWY_INLINE void InitChosenTarget() {
+  ChosenTarget& chosen_target = GetChosenTarget();
+  if (HWY_UNLIKELY(!chosen_target.IsInitialized())) {
+    chosen_target.Update(SupportedTargets());
+  }
+}
+
 }  // namespace detail
 }  // namespace hwy
 
@@ -547,6 +562,7 @@ HWY_NOINLINE void Sort16Rows(Traits st, T* HWY_RESTRICT keys, size_t num_lanes,
 template <class D, class TraitsKV, typename T>
 HWY_NOINLINE void BaseCase(D d, TraitsKV, T* HWY_RESTRICT keys,
                            size_t num_lanes, T* buf) {
+  PROFILER_ZONE("VQSort base case");
   using Traits = typename TraitsKV::SharedTraitsForSortingNetwork;
   Traits st;
   constexpr size_t kLPK = st.LanesPerKey();
@@ -752,6 +768,7 @@ HWY_INLINE void StoreRightAndBuf(D d, Traits st, const Vec<D> v,
 template <class D, class Traits, typename T>
 HWY_INLINE size_t Partition(D d, Traits st, T* const keys, const size_t num,
                             const Vec<D> pivot, T* HWY_RESTRICT buf) {
+  PROFILER_ZONE("VQSort partition");
   using V = decltype(Zero(d));
   const size_t N = Lanes(d);
 
@@ -1197,6 +1214,7 @@ HWY_INLINE size_t RandomChunkIndex(const uint32_t num_chunks, uint32_t bits) {
 template <class D, class Traits, typename T>
 HWY_INLINE void DrawSamples(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
                             T* HWY_RESTRICT buf, uint64_t* HWY_RESTRICT state) {
+  PROFILER_ZONE("VQSort draw samples");
   using V = decltype(Zero(d));
   const size_t N = Lanes(d);
 
@@ -1288,6 +1306,7 @@ HWY_INLINE bool UnsortedSampleEqual(D d, Traits st,
 
 template <class D, class Traits, typename T>
 HWY_INLINE void SortSamples(D d, Traits st, T* HWY_RESTRICT buf) {
+  PROFILER_ZONE("VQSort sort samples");
   const size_t N = Lanes(d);
   constexpr size_t kSampleLanes = Constants::SampleLanes<T>();
   // Network must be large enough to sort two chunks.
@@ -1895,12 +1914,259 @@ HWY_INLINE bool HandleSpecialCases(D d, Traits st, T* HWY_RESTRICT keys,
     return true;
   }
 
-  // We could also check for already sorted/reverse/equal, but that's probably
-  // counterproductive if vqsort is used as a base case.
+  // Sorted or reverse-sorted input is handled by HandlePresorted, which only
+  // the top-level Sort calls because that is probably counterproductive if
+  // vqsort is used as a base case.
 
   return false;  // not finished sorting
 }
 
+// ------------------------------ Presorted input
+
+// Returns the index of the first lane of the first key in [begin, end) which
+// `key` precedes, or `end` if there is none. Indices are lanes, not keys.
+template <class Traits, typename T>
+HWY_INLINE size_t FirstKeyAfter(Traits st, const T* HWY_RESTRICT key,
+                                const T* HWY_RESTRICT keys, size_t begin,
+                                size_t end) {
+  const size_t kLPK = st.LanesPerKey();
+  size_t lo = begin / kLPK;
+  size_t hi = end / kLPK;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (st.Compare1(key, keys + mid * kLPK)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo * kLPK;
+}
+
+// As above, but returns the first key in [begin, end) which does not precede
+// `key`.
+template <class Traits, typename T>
+HWY_INLINE size_t FirstKeyNotBefore(Traits st, const T* HWY_RESTRICT key,
+                                    const T* HWY_RESTRICT keys, size_t begin,
+                                    size_t end) {
+  const size_t kLPK = st.LanesPerKey();
+  size_t lo = begin / kLPK;
+  size_t hi = end / kLPK;
+  while (lo < hi) {
+    const size_t mid = lo + (hi - lo) / 2;
+    if (st.Compare1(keys + mid * kLPK, key)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo * kLPK;
+}
+
+// Upper bound on the number of runs that HandlePresorted merges. Input with
+// more runs is considered unsorted. Merging is a tree of in-place merges, so
+// this bounds the number of passes over the keys to CeilLog2(kMaxRuns).
+static constexpr size_t kMaxRuns = 16;
+
+// Splits `keys` into maximal runs of keys that are in sorted order, or in
+// reverse order if `reverse`. Adjacent keys may be equal in either case.
+// Returns the number of runs and sets run_end[r] to the end of run r in lanes.
+// If there are more than kMaxRuns, returns 0, but run_end[0] is still the end
+// of the first run. Requires num >= Lanes(d) + LanesPerKey().
+template <class D, class Traits, typename T>
+HWY_INLINE size_t FindRuns(D d, Traits st, const T* HWY_RESTRICT keys,
+                           size_t num, bool reverse,
+                           size_t* HWY_RESTRICT run_end) {
+  const size_t N = Lanes(d);
+  constexpr size_t kLPK = st.LanesPerKey();
+  HWY_DASSERT(num >= N + kLPK);
+  const size_t last = num - kLPK - N;
+  size_t num_runs = 0;
+  for (size_t i = 0;; i += N) {
+    // The last window may overlap the previous, already checked one.
+    const size_t start = HWY_MIN(i, last);
+    const Vec<D> v = LoadU(d, keys + start);
+    const Vec<D> next = LoadU(d, keys + start + kLPK);
+    // Skip pairs of keys already checked by the previous window.
+    Mask<D> out_of_order =
+        AndNot(FirstN(d, i - start),
+               reverse ? st.Compare(d, v, next) : st.Compare(d, next, v));
+    // At most kMaxRuns vectors reach this. Locating the run boundaries via the
+    // mask instead of scalar comparisons avoids a mispredicted branch per key,
+    // which matters for rejecting random input, especially small arrays. For
+    // 128-bit keys, both lanes of a key are set, so `pos` is the first lane.
+    while (HWY_UNLIKELY(!AllFalse(d, out_of_order))) {
+      const size_t pos = FindKnownFirstTrue(d, out_of_order);
+      if (num_runs == kMaxRuns - 1) return 0;
+      run_end[num_runs++] = start + pos + kLPK;
+      out_of_order = AndNot(FirstN(d, pos + kLPK), out_of_order);
+    }
+    if (start == last) break;
+  }
+  run_end[num_runs++] = num;
+  return num_runs;
+}
+
+// Reverses the order of keys (not lanes) in `keys`.
+template <class D, class Traits, typename T>
+HWY_INLINE void ReverseKeysInPlace(D d, Traits st, T* HWY_RESTRICT keys,
+                                   size_t num) {
+  const size_t N = Lanes(d);
+  constexpr size_t kLPK = st.LanesPerKey();
+  size_t lo = 0;
+  size_t hi = num;
+  for (; hi - lo >= 2 * N; lo += N, hi -= N) {
+    const Vec<D> first = LoadU(d, keys + lo);
+    const Vec<D> last = LoadU(d, keys + hi - N);
+    StoreU(st.ReverseKeys(d, last), d, keys + lo);
+    StoreU(st.ReverseKeys(d, first), d, keys + hi - N);
+  }
+  for (; hi - lo >= 2 * kLPK; lo += kLPK, hi -= kLPK) {
+    T tmp[kLPK];
+    CopyBytes<kLPK * sizeof(T)>(keys + lo, tmp);
+    CopyBytes<kLPK * sizeof(T)>(keys + hi - kLPK, keys + lo);
+    CopyBytes<kLPK * sizeof(T)>(tmp, keys + hi - kLPK);
+  }
+}
+
+// Merges the sorted keys[0, mid) and keys[mid, num). The smaller of them must
+// fit into `buf`.
+template <class Traits, typename T>
+HWY_INLINE void MergeWithBuffer(Traits st, T* HWY_RESTRICT keys, size_t mid,
+                                size_t num, T* HWY_RESTRICT buf) {
+  constexpr size_t kLPK = st.LanesPerKey();
+  if (mid <= num - mid) {
+    // Copy the left run and merge forwards; the output never overtakes the
+    // right run because it has at most `mid` fewer keys.
+    CopyBytes(keys, buf, mid * sizeof(T));
+    size_t i = 0;
+    size_t j = mid;
+    size_t out = 0;
+    while (i != mid && j != num) {
+      // Branchless because the outcome is unpredictable.
+      const bool take_right = st.Compare1(keys + j, buf + i);
+      CopyBytes<kLPK * sizeof(T)>(take_right ? keys + j : buf + i, keys + out);
+      out += kLPK;
+      j += take_right ? kLPK : 0;
+      i += take_right ? 0 : kLPK;
+    }
+    // Any remaining right keys are already in place.
+    CopyBytes(buf + i, keys + out, (mid - i) * sizeof(T));
+  } else {
+    // Copy the right run and merge backwards.
+    CopyBytes(keys + mid, buf, (num - mid) * sizeof(T));
+    size_t i = mid;
+    size_t j = num - mid;
+    size_t out = num;
+    while (i != 0 && j != 0) {
+      const bool take_left = st.Compare1(buf + j - kLPK, keys + i - kLPK);
+      out -= kLPK;
+      CopyBytes<kLPK * sizeof(T)>(take_left ? keys + i - kLPK : buf + j - kLPK,
+                                  keys + out);
+      i -= take_left ? kLPK : 0;
+      j -= take_left ? 0 : kLPK;
+    }
+    // Any remaining left keys are already in place.
+    CopyBytes(buf, keys + out - j, j * sizeof(T));
+  }
+}
+
+// Merges the sorted keys[0, mid) and keys[mid, num) in place, using only the
+// Sort `buf` as scratch space. If neither run fits into it, splits both at
+// corresponding positions, rotates the middle part and recurses, which moves
+// each key O(log(num / buffer size)) times. Returns immediately if the runs
+// do not overlap.
+template <class Traits, typename T>
+HWY_NOINLINE void MergeInPlace(Traits st, T* HWY_RESTRICT keys, size_t mid,
+                               size_t num, T* HWY_RESTRICT buf) {
+  constexpr size_t kLPK = st.LanesPerKey();
+  constexpr size_t kBufLanes =
+      SortConstants::BufBytes<T, kLPK>(HWY_MAX_BYTES) / sizeof(T) / kLPK * kLPK;
+  if (mid == 0 || mid == num) return;
+  if (!st.Compare1(keys + mid, keys + mid - kLPK)) return;
+
+  if (HWY_MIN(mid, num - mid) <= kBufLanes) {
+    MergeWithBuffer(st, keys, mid, num, buf);
+    return;
+  }
+
+  // Split the larger run in half and find the matching position in the other.
+  size_t cut_left;
+  size_t cut_right;
+  if (mid > num - mid) {
+    cut_left = mid / kLPK / 2 * kLPK;
+    cut_right = FirstKeyNotBefore(st, keys + cut_left, keys, mid, num);
+  } else {
+    cut_right = mid + (num - mid) / kLPK / 2 * kLPK;
+    cut_left = FirstKeyAfter(st, keys + cut_right, keys, 0, mid);
+  }
+  std::rotate(keys + cut_left, keys + mid, keys + cut_right);
+  const size_t new_mid = cut_left + (cut_right - mid);
+  MergeInPlace(st, keys, cut_left, new_mid, buf);
+  MergeInPlace(st, keys + new_mid, cut_right - new_mid, num - new_mid, buf);
+}
+
+// Handles input that consists of a few sorted or reverse-sorted runs, for
+// example sorted input with some late arrivals, or input that is sorted except
+// for a short suffix, e.g. appended keys. Returns the number of leading lanes
+// that are sorted: `num` if sorting is finished, otherwise the caller sorts
+// the remaining keys and calls MergeInPlace. Random input typically only
+// costs a few comparisons; others at most one pass over the keys plus
+// CeilLog2(kMaxRuns) merge passes. Does not allocate; `buf` is scratch space.
+template <class D, class Traits, typename T>
+HWY_INLINE size_t HandlePresorted(D d, Traits st, T* HWY_RESTRICT keys,
+                                  size_t num, T* HWY_RESTRICT buf) {
+  PROFILER_ZONE("VQSort presorted");
+  // Decide the direction from the first key that differs from the first key,
+  // so that leading equal keys do not hide reverse-sorted input.
+  size_t idx_second = 0;
+  if (HWY_UNLIKELY(AllEqual(d, st, st.SetKey(d, keys), keys, num,
+                            &idx_second))) {
+    return num;
+  }
+  const bool reverse = st.Compare1(keys + idx_second, keys);
+
+  size_t run_end[kMaxRuns];
+  size_t num_runs = FindRuns(d, st, keys, num, reverse, run_end);
+  if (num_runs == 0) {
+    // Too many runs, but sorting only a short unsorted suffix and merging it
+    // is still cheaper than sorting everything.
+    const size_t num_sorted = run_end[0];
+    if (num - num_sorted > num / 8) return 0;
+    if (VQSORT_PRINT >= 1) {
+      fprintf(stderr, "Special-casing sorted prefix of %zu/%zu lanes\n",
+              num_sorted, num);
+    }
+    if (reverse) ReverseKeysInPlace(d, st, keys, num_sorted);
+    return num_sorted;
+  }
+
+  if (VQSORT_PRINT >= 1) {
+    fprintf(stderr, "Special-casing %zu %s runs\n", num_runs,
+            reverse ? "reverse-sorted" : "sorted");
+  }
+  if (reverse) {
+    size_t begin = 0;
+    for (size_t r = 0; r < num_runs; ++r) {
+      ReverseKeysInPlace(d, st, keys + begin, run_end[r] - begin);
+      begin = run_end[r];
+    }
+  }
+  // Merge pairs of adjacent runs until only one remains.
+  while (num_runs > 1) {
+    size_t begin = 0;
+    size_t num_merged = 0;
+    for (size_t r = 0; r < num_runs; r += 2) {
+      const size_t end = run_end[HWY_MIN(r + 1, num_runs - 1)];
+      MergeInPlace(st, keys + begin, run_end[r] - begin, end - begin, buf);
+      run_end[num_merged++] = end;
+      begin = end;
+    }
+    num_runs = num_merged;
+  }
+  return num;
+}
+
 #endif  // VQSORT_ENABLED
 
 template <class D, class Traits, typename T, HWY_IF_FLOAT(T)>
@@ -1959,12 +2225,17 @@ void Sort(D d, Traits st, T* HWY_RESTRICT keys, const size_t num,
 
 #if VQSORT_ENABLED || HWY_IDE
   if (!detail::HandleSpecialCases(d, st, keys, num, buf)) {
-    uint64_t* HWY_RESTRICT state = hwy::detail::GetGeneratorStateStatic();
     // Introspection: switch to worst-case N*logN heapsort after this many.
     // Should never be reached, so computing log2 exactly does not help.
     const size_t max_levels = 50;
-    detail::Recurse<detail::RecurseMode::kSort>(d, st, keys, num, buf, state,
-                                                max_levels);
+    const size_t num_sorted = detail::HandlePresorted(d, st, keys, num, buf);
+    if (num_sorted != num) {
+      // Not before HandlePresorted, which does not require the TLS state.
+      uint64_t* HWY_RESTRICT state = hwy::detail::GetGeneratorStateStatic();
+      detail::Recurse<detail::RecurseMode::kSort>(
+          d, st, keys + num_sorted, num - num_sorted, buf, state, max_levels);
+      detail::MergeInPlace(st, keys, num_sorted, num, buf);
+    }
   }
 #else   // !VQSORT_ENABLED
   (void)d;
@@ -2105,6 +2376,373 @@ HWY_API void Select(D d, Traits st, T* HWY_RESTRICT keys, const size_t num,
   Select(d, st, keys, num, k, buf);
 }
 
+// ------------------------------ Parallel sort
+
+namespace detail {
+
+#if VQSORT_ENABLED || HWY_IDE
+
+// Subarray of `keys`, in units of lanes.
+struct SortRange {
+  size_t begin;
+  size_t num;
+};
+
+// Part of a `SortRange` that a single worker partitions.
+struct SortChunk {
+  size_t range;  // index of the range within the current level
+  size_t begin;  // in lanes, relative to `keys`
+  size_t num;
+  size_t bound;  // returned by `Partition`, relative to `begin`
+};
+
+// Swaps `num` of the misplaced keys of a range, starting at `first`.
+struct SortSwap {
+  size_t range;
+  size_t first;
+  size_t num;
+};
+
+// Number of lanes that a worker partitions at a time, rounded down to whole
+// keys.
+template <typename T, size_t kLPK>
+constexpr size_t ParallelChunkLanes() {
+  return HWY_MAX(Constants::kParallelChunkBytes / sizeof(T) / kLPK, 1) * kLPK;
+}
+
+// Swaps the non-overlapping `a[0, num)` and `b[0, num)`.
+template <class D, typename T>
+HWY_INLINE void SwapLanes(D d, T* HWY_RESTRICT a, T* HWY_RESTRICT b,
+                          const size_t num) {
+  const size_t N = Lanes(d);
+  size_t i = 0;
+  if (num >= N) {
+    for (; i <= num - N; i += N) {
+      const Vec<D> va = LoadU(d, a + i);
+      const Vec<D> vb = LoadU(d, b + i);
+      StoreU(vb, d, a + i);
+      StoreU(va, d, b + i);
+    }
+  }
+  const size_t remaining = num - i;
+  const Vec<D> va = LoadN(d, a + i, remaining);
+  const Vec<D> vb = LoadN(d, b + i, remaining);
+  StoreN(vb, d, a + i, remaining);
+  StoreN(va, d, b + i, remaining);
+}
+
+// Partitions each of `partitioned` around the corresponding key of `pivots`
+// (kLPK lanes per range) using all workers: each partitions a chunk of a range with
+// the same pivot, and then they swap the right-partition keys that precede the
+// split with left-partition keys that follow it. Sets splits[r] to the end of
+// the left partition of range r, which may be empty or the whole range.
+template <class D, class Traits, typename T>
+void PartitionRangesParallel(D d, Traits st, T* HWY_RESTRICT keys,
+                             const std::vector<SortRange>& partitioned,
+                             const std::vector<T>& pivots, ThreadPool& pool,
+                             std::vector<size_t>& splits) {
+  constexpr size_t kLPK = st.LanesPerKey();
+  constexpr size_t kBufNum = Constants::BufBytes<T, kLPK>(HWY_MAX_BYTES) /
+                             sizeof(T);
+  constexpr size_t kChunkLanes = ParallelChunkLanes<T, kLPK>();
+  const size_t num_workers = pool.NumWorkers();
+  splits.clear();
+  if (partitioned.empty()) return;
+
+  std::vector<SortChunk> chunks;
+  for (size_t r = 0; r < partitioned.size(); ++r) {
+    const SortRange& range = partitioned[r];
+    const size_t num_keys = range.num / kLPK;
+    const size_t num_chunks =
+        HWY_MAX(HWY_MIN(num_workers, range.num / kChunkLanes), size_t{1});
+    for (size_t i = 0; i < num_chunks; ++i) {
+      const size_t begin = range.begin + (i * num_keys / num_chunks) * kLPK;
+      const size_t end = range.begin + ((i + 1) * num_keys / num_chunks) * kLPK;
+      chunks.push_back(SortChunk{r, begin, end - begin, 0});
+    }
+  }
+
+  pool.Run(0, chunks.size(), [&](uint64_t task, size_t /*thread*/) HWY_ATTR {
+    HWY_ALIGN T chunk_buf[kBufNum];
+    SortChunk& chunk = chunks[task];
+    const Vec<D> pivot = st.SetKey(d, pivots.data() + chunk.range * kLPK);
+    chunk.bound =
+        Partition(d, st, keys + chunk.begin, chunk.num, pivot, chunk_buf);
+  });
+
+  // The left partition of each range ends at its split. Gather the intervals
+  // of misplaced keys: right keys before the split, and left keys after it.
+  // Chunks are ordered by range, hence so are the intervals.
+  splits.resize(partitioned.size());
+  for (size_t r = 0; r < partitioned.size(); ++r) {
+    splits[r] = partitioned[r].begin;
+  }
+  for (const SortChunk& chunk : chunks) {
+    splits[chunk.range] += chunk.bound;
+  }
+  std::vector<SortRange> right_before;
+  std::vector<SortRange> left_after;
+  // Index of the first interval of each range, plus one past the end.
+  std::vector<size_t> first_right(partitioned.size() + 1);
+  std::vector<size_t> first_left(partitioned.size() + 1);
+  std::vector<SortSwap> swaps;
+  size_t idx_chunk = 0;
+  for (size_t r = 0; r < partitioned.size(); ++r) {
+    first_right[r] = right_before.size();
+    first_left[r] = left_after.size();
+    const size_t split = splits[r];
+    size_t num_misplaced = 0;
+    for (; idx_chunk < chunks.size() && chunks[idx_chunk].range == r;
+         ++idx_chunk) {
+      const SortChunk& chunk = chunks[idx_chunk];
+      const size_t mid = chunk.begin + chunk.bound;
+      if (mid < split) {
+        const size_t end = HWY_MIN(chunk.begin + chunk.num, split);
+        right_before.push_back(SortRange{mid, end - mid});
+        num_misplaced += end - mid;
+      } else if (mid > split) {
+        const size_t begin = HWY_MAX(chunk.begin, split);
+        left_after.push_back(SortRange{begin, mid - begin});
+      }
+    }
+
+    const size_t num_swaps = HWY_MIN(
+        num_workers, DivCeil(num_misplaced, kChunkLanes));
+    for (size_t i = 0; i < num_swaps; ++i) {
+      const size_t first = i * num_misplaced / num_swaps;
+      const size_t end = (i + 1) * num_misplaced / num_swaps;
+      swaps.push_back(SortSwap{r, first, end - first});
+    }
+  }
+  first_right[partitioned.size()] = right_before.size();
+  first_left[partitioned.size()] = left_after.size();
+
+  pool.Run(0, swaps.size(), [&](uint64_t task, size_t /*thread*/) HWY_ATTR {
+    const SortSwap& swap = swaps[task];
+    // Find the intervals containing the first misplaced key of this task.
+    size_t idx_right = first_right[swap.range];
+    size_t idx_left = first_left[swap.range];
+    size_t offset_right = swap.first;
+    size_t offset_left = swap.first;
+    while (offset_right >= right_before[idx_right].num) {
+      offset_right -= right_before[idx_right++].num;
+    }
+    while (offset_left >= left_after[idx_left].num) {
+      offset_left -= left_after[idx_left++].num;
+    }
+
+    size_t remaining = swap.num;
+    while (remaining != 0) {
+      HWY_DASSERT(idx_right < first_right[swap.range + 1]);
+      HWY_DASSERT(idx_left < first_left[swap.range + 1]);
+      const SortRange& right = right_before[idx_right];
+      const SortRange& left = left_after[idx_left];
+      const size_t num = HWY_MIN(
+          remaining,
+          HWY_MIN(right.num - offset_right, left.num - offset_left));
+      SwapLanes(d, keys + right.begin + offset_right,
+                keys + left.begin + offset_left, num);
+      remaining -= num;
+      offset_right += num;
+      offset_left += num;
+      if (offset_right == right.num) {
+        ++idx_right;
+        offset_right = 0;
+      }
+      if (offset_left == left.num) {
+        ++idx_left;
+        offset_left = 0;
+      }
+    }
+  });
+
+}
+
+// Partitions each of `ranges` using all workers. Appends the resulting
+// subarrays to `large` if they have at least `min_large` lanes, otherwise to
+// `small`. If the samples of a range are all equal, the sample is likely a
+// common key. Such ranges are partitioned twice, first splitting off the keys
+// after the sample and then those equal to it, which need no sorting.
+template <class D, class Traits, typename T>
+void PartitionParallel(D d, Traits st, T* HWY_RESTRICT keys,
+                       const std::vector<SortRange>& ranges, size_t min_large,
+                       ThreadPool& pool, std::vector<SortRange>& large,
+                       std::vector<SortRange>& small) {
+  constexpr size_t kLPK = st.LanesPerKey();
+  constexpr size_t kBufNum = Constants::BufBytes<T, kLPK>(HWY_MAX_BYTES) /
+                             sizeof(T);
+  const auto append = [&](const SortRange& range) {
+    if (range.num != 0) (range.num >= min_large ? large : small).push_back(range);
+  };
+
+  // Choose pivots serially because sampling is cheap. Ranges with equal
+  // samples follow the others.
+  HWY_ALIGN T buf[kBufNum];
+  uint64_t* HWY_RESTRICT state = hwy::detail::GetGeneratorStateStatic();
+  std::vector<SortRange> partitioned;
+  std::vector<T> pivots;  // kLPK lanes per partitioned range
+  std::vector<SortRange> equal;
+  std::vector<T> equal_pivots;
+  for (const SortRange& range : ranges) {
+    DrawSamples(d, st, keys + range.begin, range.num, buf, state);
+    if (HWY_UNLIKELY(UnsortedSampleEqual(d, st, buf))) {
+      equal.push_back(range);
+      equal_pivots.insert(equal_pivots.end(), buf, buf + kLPK);
+      continue;
+    }
+    SortSamples(d, st, buf);
+    // Never the largest key, hence neither partition is empty.
+    const size_t rank = PivotRank(st, buf);
+    pivots.insert(pivots.end(), buf + rank, buf + rank + kLPK);
+    partitioned.push_back(range);
+  }
+  const size_t num_normal = partitioned.size();
+  partitioned.insert(partitioned.end(), equal.begin(), equal.end());
+  pivots.insert(pivots.end(), equal_pivots.begin(), equal_pivots.end());
+
+  std::vector<size_t> splits;
+  PartitionRangesParallel(d, st, keys, partitioned, pivots, pool, splits);
+
+  // Left partitions of ranges with equal samples, and the key before their
+  // pivot, which splits off the keys equal to the pivot.
+  std::vector<SortRange> before;
+  std::vector<T> before_pivots;
+  for (size_t r = 0; r < partitioned.size(); ++r) {
+    const SortRange& range = partitioned[r];
+    const SortRange left = {range.begin, splits[r] - range.begin};
+    const SortRange right = {splits[r], range.begin + range.num - splits[r]};
+    if (r < num_normal) {
+      HWY_DASSERT(left.num != 0 && right.num != 0);
+      append(left);
+      append(right);
+      continue;
+    }
+
+    append(right);
+    // `left` is at most the pivot. If the pivot is the first possible value,
+    // all keys in `left` are equal and thus already sorted.
+    const Vec<D> pivot = st.SetKey(d, pivots.data() + r * kLPK);
+    if (HWY_UNLIKELY(AllTrue(d, st.EqualKeys(d, pivot, st.FirstValue(d))))) {
+      continue;
+    }
+    if (left.num < min_large) {
+      append(left);
+      continue;
+    }
+    Store(st.PrevValue(d, pivot), d, buf);
+    before.push_back(left);
+    before_pivots.insert(before_pivots.end(), buf, buf + kLPK);
+  }
+  if (before.empty()) return;
+
+  PartitionRangesParallel(d, st, keys, before, before_pivots, pool, splits);
+  for (size_t r = 0; r < before.size(); ++r) {
+    // The right partition is equal to the pivot of the range.
+    append(SortRange{before[r].begin, splits[r] - before[r].begin});
+  }
+}
+
+// Precondition: `HandleSpecialCases` returned false.
+template <class D, class Traits, typename T>
+void SortParallel(D d, Traits st, T* HWY_RESTRICT keys, size_t num,
+                  ThreadPool& pool) {
+  constexpr size_t kLPK = st.LanesPerKey();
+  const size_t num_workers = pool.NumWorkers();
+  // Partition until there are several subarrays per worker, so that work
+  // stealing can balance their differing sizes.
+  constexpr size_t kChunkLanes = ParallelChunkLanes<T, kLPK>();
+  const size_t min_large = HWY_MAX(2 * kChunkLanes, num / (4 * num_workers));
+  // Each level is a pass over the keys that single-threaded Recurse would also
+  // have done. Only unbalanced pivots require more than a few levels.
+  const size_t max_parallel_levels = 2 * CeilLog2(4 * num_workers) + 4;
+
+  std::vector<SortRange> large = {SortRange{0, num}};
+  std::vector<SortRange> next;
+  std::vector<SortRange> small;
+  for (size_t level = 0; !large.empty() && level < max_parallel_levels;
+       ++level) {
+    next.clear();
+    PartitionParallel(d, st, keys, large, min_large, pool, next, small);
+    large.swap(next);
+  }
+  small.insert(small.end(), large.begin(), large.end());
+
+  pool.Run(0, small.size(), [&](uint64_t task, size_t /*thread*/) HWY_ATTR {
+    HWY_ALIGN T buf[Constants::BufBytes<T, kLPK>(HWY_MAX_BYTES) / sizeof(T)];
+    uint64_t* HWY_RESTRICT state = hwy::detail::GetGeneratorStateStatic();
+    const SortRange& range = small[task];
+    const size_t max_levels = 50;  // as in Sort
+    Recurse<RecurseMode::kSort>(d, st, keys + range.begin, range.num, buf,
+                                state, max_levels);
+  });
+}
+
+#endif  // VQSORT_ENABLED
+
+}  // namespace detail
+
+// Same as `Sort`, but uses all workers of `pool` if `num` is large enough to
+// amortize the fork-join overhead. The top levels of the recursion partition
+// subarrays in parallel; then each resulting subarray is sorted by a single
+// worker. Allocates memory proportional to the number of workers, but not to
+// `num`. Same thread-safety as `pool.Run`.
+template <class D, class Traits, typename T>
+void Sort(D d, Traits st, T* HWY_RESTRICT keys, const size_t num,
+          ThreadPool& pool) {
+#if HWY_MAX_BYTES > 64
+  // sorting_networks-inl and traits assume no more than 512 bit vectors.
+  if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
+    return Sort(CappedTag<T, 64 / sizeof(T)>(), st, keys, num, pool);
+  }
+#endif  // HWY_MAX_BYTES > 64
+
+#if VQSORT_ENABLED || HWY_IDE
+  constexpr size_t kLPK = st.LanesPerKey();
+  constexpr size_t kChunkLanes = detail::ParallelChunkLanes<T, kLPK>();
+  if (pool.NumWorkers() > 1 && num >= 2 * kChunkLanes) {
+    if (VQSORT_PRINT >= 1) {
+      fprintf(stderr, "=============== SortParallel num %zu workers %zu\n",
+              num, pool.NumWorkers());
+    }
+
+    size_t num_nan = 0;
+    if (hwy::IsFloat<T>()) {
+      const size_t num_chunks = DivCeil(num, kChunkLanes);
+      std::vector<size_t> chunk_nan(num_chunks);
+      pool.Run(0, num_chunks, [&](uint64_t chunk, size_t /*thread*/) HWY_ATTR {
+        const size_t begin = chunk * kChunkLanes;
+        chunk_nan[chunk] = detail::CountAndReplaceNaN(
+            d, st, keys + begin, HWY_MIN(kChunkLanes, num - begin));
+      });
+      for (size_t count : chunk_nan) num_nan += count;
+    }
+
+    HWY_ALIGN T buf[SortConstants::BufBytes<T, kLPK>(HWY_MAX_BYTES) /
+                    sizeof(T)];
+    if (!detail::HandleSpecialCases(d, st, keys, num, buf)) {
+      const size_t num_sorted = detail::HandlePresorted(d, st, keys, num, buf);
+      const size_t num_unsorted = num - num_sorted;
+      if (num_unsorted >= 2 * kChunkLanes) {
+        detail::SortParallel(d, st, keys + num_sorted, num_unsorted, pool);
+      } else if (num_unsorted != 0) {
+        uint64_t* HWY_RESTRICT state = hwy::detail::GetGeneratorStateStatic();
+        const size_t max_levels = 50;  // as in Sort
+        detail::Recurse<detail::RecurseMode::kSort>(
+            d, st, keys + num_sorted, num_unsorted, buf, state, max_levels);
+      }
+      detail::MergeInPlace(st, keys, num_sorted, num, buf);
+    }
+
+    if (num_nan != 0) {
+      Fill(d, GetLane(NaN(d)), num_nan, keys + num - num_nan);
+    }
+    return;
+  }
+#endif  // VQSORT_ENABLED
+
+  Sort(d, st, keys, num);
+}
+
 #if VQSORT_ENABLED
 // Adapter from VQSort[Static] to SortTag and Traits*/Order*.
 namespace detail {
@@ -2185,6 +2823,42 @@ void VQSortStatic(T* HWY_RESTRICT keys, const size_t num, SortDescending) {
 #endif  // VQSORT_ENABLED
 }
 
+template <typename T>
+void VQSortStatic(T* HWY_RESTRICT keys, const size_t num, SortAscending,
+                  ThreadPool& pool) {
+#if VQSORT_ENABLED
+  using Adapter = detail::KeyAdapter<T>;
+  using Order = typename Adapter::Ascending;
+  const detail::SharedTraits<typename Adapter::template Traits<Order>> st;
+  using LaneType = typename decltype(st)::LaneType;
+  const SortTag<LaneType> d;
+  Sort(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(), pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif  // VQSORT_ENABLED
+}
+
+template <typename T>
+void VQSortStatic(T* HWY_RESTRICT keys, const size_t num, SortDescending,
+                  ThreadPool& pool) {
+#if VQSORT_ENABLED
+  using Adapter = detail::KeyAdapter<T>;
+  using Order = typename Adapter::Descending;
+  const detail::SharedTraits<typename Adapter::template Traits<Order>> st;
+  using LaneType = typename decltype(st)::LaneType;
+  const SortTag<LaneType> d;
+  Sort(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(), pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif  // VQSORT_ENABLED
+}
+
 template <typename T>
 void VQPartialSortStatic(T* HWY_RESTRICT keys, const size_t num, const size_t k,
                          SortAscending) {
@@ -2195,7 +2869,7 @@ void VQPartialSortStatic(T* HWY_RESTRICT keys, const size_t num, const size_t k,
   using LaneType = typename decltype(st)::LaneType;
   const SortTag<LaneType> d;
   PartialSort(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(),
-              k);
+              k * st.LanesPerKey());
 #else
   (void)keys;
   (void)num;
@@ -2214,7 +2888,7 @@ void VQPartialSortStatic(T* HWY_RESTRICT keys, const size_t num, const size_t k,
   using LaneType = typename decltype(st)::LaneType;
   const SortTag<LaneType> d;
   PartialSort(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(),
-              k);
+              k * st.LanesPerKey());
 #else
   (void)keys;
   (void)num;
@@ -2232,7 +2906,8 @@ void VQSelectStatic(T* HWY_RESTRICT keys, const size_t num, const size_t k,
   const detail::SharedTraits<typename Adapter::template Traits<Order>> st;
   using LaneType = typename decltype(st)::LaneType;
   const SortTag<LaneType> d;
-  Select(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(), k);
+  Select(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(),
+         k * st.LanesPerKey());
 #else
   (void)keys;
   (void)num;
@@ -2250,7 +2925,8 @@ void VQSelectStatic(T* HWY_RESTRICT keys, const size_t num, const size_t k,
   const detail::SharedTraits<typename Adapter::template Traits<Order>> st;
   using LaneType = typename decltype(st)::LaneType;
   const SortTag<LaneType> d;
-  Select(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(), k);
+  Select(d, st, reinterpret_cast<LaneType*>(keys), num * st.LanesPerKey(),
+         k * st.LanesPerKey());
 #else
   (void)keys;
   (void)num;
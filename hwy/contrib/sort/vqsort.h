@@ -80,6 +80,18 @@ HWY_CONTRIB_DLLEXPORT void VQSort(double* HWY_RESTRICT keys, const size_t n,
 HWY_CONTRIB_DLLEXPORT void VQSort(double* HWY_RESTRICT keys, const size_t n,
                                   SortDescending);
 
+// Same as above, but NaN are placed according to `nan`, see SortNaN. The keys
+// are transformed into unsigned integers and back, so this is about as fast as
+// sorting integers. Unlike the above, does not require hwy::HaveFloat64().
+HWY_CONTRIB_DLLEXPORT void VQSort(float* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, SortNaN nan);
+HWY_CONTRIB_DLLEXPORT void VQSort(float* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, SortNaN nan);
+HWY_CONTRIB_DLLEXPORT void VQSort(double* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, SortNaN nan);
+HWY_CONTRIB_DLLEXPORT void VQSort(double* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, SortNaN nan);
+
 HWY_CONTRIB_DLLEXPORT void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n,
                                   SortAscending);
 HWY_CONTRIB_DLLEXPORT void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n,
@@ -93,6 +105,68 @@ HWY_CONTRIB_DLLEXPORT void VQSort(K32V32* HWY_RESTRICT keys, const size_t n,
 HWY_CONTRIB_DLLEXPORT void VQSort(K32V32* HWY_RESTRICT keys, const size_t n,
                                   SortDescending);
 
+class ThreadPool;  // from hwy/contrib/thread_pool/thread_pool.h
+
+// Parallel Vectorized Quicksort: same as above, but arrays of at least several
+// hundred KiB are partitioned and sorted by all workers of `pool`. Allocates
+// memory proportional to the number of workers, but not to `n`. Must not be
+// called concurrently with other `pool.Run` unless the pool is in concurrent
+// mode.
+HWY_CONTRIB_DLLEXPORT void VQSort(uint16_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(uint16_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(uint32_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(uint32_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(uint64_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(uint64_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(int16_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(int16_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(int32_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(int32_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(int64_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(int64_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+
+// These two must only be called if hwy::HaveFloat16() is true.
+HWY_CONTRIB_DLLEXPORT void VQSort(float16_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(float16_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+
+HWY_CONTRIB_DLLEXPORT void VQSort(float* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(float* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+
+// These two must only be called if hwy::HaveFloat64() is true.
+HWY_CONTRIB_DLLEXPORT void VQSort(double* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(double* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+
+HWY_CONTRIB_DLLEXPORT void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(K64V64* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(K64V64* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(K32V32* HWY_RESTRICT keys, const size_t n,
+                                  SortAscending, ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSort(K32V32* HWY_RESTRICT keys, const size_t n,
+                                  SortDescending, ThreadPool& pool);
+
 // Vectorized QuickPartialsort:
 // Rearranges elements such that the range [0, k) contains the sorted k − first
 // smallest elements in the range [0, n). Does not preserve the ordering of
@@ -242,6 +316,741 @@ HWY_CONTRIB_DLLEXPORT void VQSelect(K32V32* HWY_RESTRICT keys, const size_t n,
 HWY_CONTRIB_DLLEXPORT void VQSelect(K32V32* HWY_RESTRICT keys, const size_t n,
                                     const size_t k, SortDescending);
 
+// Vectorized stable argsort: writes to indices[0, n) the permutation that
+// sorts keys[0, n), i.e. keys[indices[i]] is the i-th key in sorted order.
+// Equivalent keys retain their original order, hence argsort of a column and
+// stable sorting of rows are the same operation. `keys` are not modified.
+// -0.0 and +0.0 are equivalent, and NaN are placed after all other keys. The
+// uint32_t overloads require n <= 2^32. Allocates 8 bytes per key for 32-bit
+// keys and otherwise 16.
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int32_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const float* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const float* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const float* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const float* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const uint64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const int64_t* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const double* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const double* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint32_t* HWY_RESTRICT indices,
+                                     SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const double* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQArgSort(const double* HWY_RESTRICT keys,
+                                     const size_t n,
+                                     uint64_t* HWY_RESTRICT indices,
+                                     SortDescending);
+
+// Stable Vectorized Quicksort of key-value pairs: same as VQSort, but pairs
+// with equal keys retain their original order. Allocates 16 bytes per pair for
+// K64V64 and 8 for K32V32, which also requires n <= 2^32.
+HWY_CONTRIB_DLLEXPORT void VQStableSort(K64V64* HWY_RESTRICT keys,
+                                        const size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQStableSort(K64V64* HWY_RESTRICT keys,
+                                        const size_t n, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQStableSort(K32V32* HWY_RESTRICT keys,
+                                        const size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQStableSort(K32V32* HWY_RESTRICT keys,
+                                        const size_t n, SortDescending);
+
+// Vectorized merge of two arrays a[0, num_a) and b[0, num_b), each sorted in
+// the given order, into out[0, num_a + num_b). `out` must not overlap the
+// inputs. The inputs must not contain NaN. The result is sorted, but not
+// stable: equivalent key-value pairs may be reordered.
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint16_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint16_t* HWY_RESTRICT b,
+                                   size_t num_b, uint16_t* HWY_RESTRICT out,
+                                   SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint16_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint16_t* HWY_RESTRICT b,
+                                   size_t num_b, uint16_t* HWY_RESTRICT out,
+                                   SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint32_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint32_t* HWY_RESTRICT b,
+                                   size_t num_b, uint32_t* HWY_RESTRICT out,
+                                   SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint32_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint32_t* HWY_RESTRICT b,
+                                   size_t num_b, uint32_t* HWY_RESTRICT out,
+                                   SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint64_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint64_t* HWY_RESTRICT b,
+                                   size_t num_b, uint64_t* HWY_RESTRICT out,
+                                   SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint64_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint64_t* HWY_RESTRICT b,
+                                   size_t num_b, uint64_t* HWY_RESTRICT out,
+                                   SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const int16_t* HWY_RESTRICT a, size_t num_a,
+                                   const int16_t* HWY_RESTRICT b, size_t num_b,
+                                   int16_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const int16_t* HWY_RESTRICT a, size_t num_a,
+                                   const int16_t* HWY_RESTRICT b, size_t num_b,
+                                   int16_t* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const int32_t* HWY_RESTRICT a, size_t num_a,
+                                   const int32_t* HWY_RESTRICT b, size_t num_b,
+                                   int32_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const int32_t* HWY_RESTRICT a, size_t num_a,
+                                   const int32_t* HWY_RESTRICT b, size_t num_b,
+                                   int32_t* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const int64_t* HWY_RESTRICT a, size_t num_a,
+                                   const int64_t* HWY_RESTRICT b, size_t num_b,
+                                   int64_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const int64_t* HWY_RESTRICT a, size_t num_a,
+                                   const int64_t* HWY_RESTRICT b, size_t num_b,
+                                   int64_t* HWY_RESTRICT out, SortDescending);
+// These two must only be called if hwy::HaveFloat16() is true.
+HWY_CONTRIB_DLLEXPORT void VQMerge(const float16_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const float16_t* HWY_RESTRICT b,
+                                   size_t num_b, float16_t* HWY_RESTRICT out,
+                                   SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const float16_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const float16_t* HWY_RESTRICT b,
+                                   size_t num_b, float16_t* HWY_RESTRICT out,
+                                   SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const float* HWY_RESTRICT a, size_t num_a,
+                                   const float* HWY_RESTRICT b, size_t num_b,
+                                   float* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const float* HWY_RESTRICT a, size_t num_a,
+                                   const float* HWY_RESTRICT b, size_t num_b,
+                                   float* HWY_RESTRICT out, SortDescending);
+// These two must only be called if hwy::HaveFloat64() is true.
+HWY_CONTRIB_DLLEXPORT void VQMerge(const double* HWY_RESTRICT a, size_t num_a,
+                                   const double* HWY_RESTRICT b, size_t num_b,
+                                   double* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const double* HWY_RESTRICT a, size_t num_a,
+                                   const double* HWY_RESTRICT b, size_t num_b,
+                                   double* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint128_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint128_t* HWY_RESTRICT b,
+                                   size_t num_b, uint128_t* HWY_RESTRICT out,
+                                   SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const uint128_t* HWY_RESTRICT a,
+                                   size_t num_a,
+                                   const uint128_t* HWY_RESTRICT b,
+                                   size_t num_b, uint128_t* HWY_RESTRICT out,
+                                   SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const K64V64* HWY_RESTRICT a, size_t num_a,
+                                   const K64V64* HWY_RESTRICT b, size_t num_b,
+                                   K64V64* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const K64V64* HWY_RESTRICT a, size_t num_a,
+                                   const K64V64* HWY_RESTRICT b, size_t num_b,
+                                   K64V64* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const K32V32* HWY_RESTRICT a, size_t num_a,
+                                   const K32V32* HWY_RESTRICT b, size_t num_b,
+                                   K32V32* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMerge(const K32V32* HWY_RESTRICT a, size_t num_a,
+                                   const K32V32* HWY_RESTRICT b, size_t num_b,
+                                   K32V32* HWY_RESTRICT out, SortDescending);
+
+// Merges `num_runs` sorted arrays, where runs[i] has num[i] keys, into `out`,
+// which must have room for all keys and not overlap the runs. Uses a balanced
+// tree of two-way merges, which allocates a buffer of the total size if there
+// are more than two runs. The same requirements as for VQMerge apply.
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint16_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint16_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint16_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint16_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint32_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint32_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint32_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint32_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint64_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint64_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint64_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint64_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const int16_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       int16_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const int16_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       int16_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const int32_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       int32_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const int32_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       int32_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const int64_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       int64_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const int64_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       int64_t* HWY_RESTRICT out,
+                                       SortDescending);
+// These two must only be called if hwy::HaveFloat16() is true.
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const float16_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       float16_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const float16_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       float16_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const float* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       float* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const float* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       float* HWY_RESTRICT out, SortDescending);
+// These two must only be called if hwy::HaveFloat64() is true.
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const double* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       double* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const double* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       double* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint128_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint128_t* HWY_RESTRICT out,
+                                       SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const uint128_t* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       uint128_t* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const K64V64* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       K64V64* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const K64V64* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       K64V64* HWY_RESTRICT out,
+                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const K32V32* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       K32V32* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQMergeRuns(const K32V32* const* runs,
+                                       const size_t* num, size_t num_runs,
+                                       K32V32* HWY_RESTRICT out,
+                                       SortDescending);
+
+// Removes consecutive duplicates from keys[0, n) and returns their new number
+// new_n; keys[0, new_n) are the first key of each run of equal keys, as with
+// std::unique. Floating-point keys are equal if they compare equal, or are
+// both NaN. Typically called after VQSort, hence VQSortUnique does both.
+HWY_CONTRIB_DLLEXPORT size_t VQUnique(uint32_t* HWY_RESTRICT keys, size_t n);
+HWY_CONTRIB_DLLEXPORT size_t VQUnique(int32_t* HWY_RESTRICT keys, size_t n);
+HWY_CONTRIB_DLLEXPORT size_t VQUnique(float* HWY_RESTRICT keys, size_t n);
+HWY_CONTRIB_DLLEXPORT size_t VQUnique(uint64_t* HWY_RESTRICT keys, size_t n);
+HWY_CONTRIB_DLLEXPORT size_t VQUnique(int64_t* HWY_RESTRICT keys, size_t n);
+HWY_CONTRIB_DLLEXPORT size_t VQUnique(double* HWY_RESTRICT keys, size_t n);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(uint32_t* HWY_RESTRICT keys,
+                                           size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(uint32_t* HWY_RESTRICT keys,
+                                           size_t n, SortDescending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(int32_t* HWY_RESTRICT keys,
+                                           size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(int32_t* HWY_RESTRICT keys,
+                                           size_t n, SortDescending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(float* HWY_RESTRICT keys,
+                                           size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(float* HWY_RESTRICT keys,
+                                           size_t n, SortDescending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(uint64_t* HWY_RESTRICT keys,
+                                           size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(uint64_t* HWY_RESTRICT keys,
+                                           size_t n, SortDescending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(int64_t* HWY_RESTRICT keys,
+                                           size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(int64_t* HWY_RESTRICT keys,
+                                           size_t n, SortDescending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(double* HWY_RESTRICT keys,
+                                           size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT size_t VQSortUnique(double* HWY_RESTRICT keys,
+                                           size_t n, SortDescending);
+
+// Writes the first key of each run of equal keys in keys[0, n) to `unique` and
+// the length of the run to `counts`, and returns the number of runs. For
+// sorted keys, these are the distinct keys and their number of occurrences.
+// Keys are compared as in VQUnique. Both outputs must have space for n
+// entries. `unique` may be the same as `keys`.
+HWY_CONTRIB_DLLEXPORT size_t VQUniqueCounts(const uint32_t* keys, size_t n,
+                                             uint32_t* unique,
+                                             uint64_t* HWY_RESTRICT counts);
+HWY_CONTRIB_DLLEXPORT size_t VQUniqueCounts(const int32_t* keys, size_t n,
+                                             int32_t* unique,
+                                             uint64_t* HWY_RESTRICT counts);
+HWY_CONTRIB_DLLEXPORT size_t VQUniqueCounts(const float* keys, size_t n,
+                                             float* unique,
+                                             uint64_t* HWY_RESTRICT counts);
+HWY_CONTRIB_DLLEXPORT size_t VQUniqueCounts(const uint64_t* keys, size_t n,
+                                             uint64_t* unique,
+                                             uint64_t* HWY_RESTRICT counts);
+HWY_CONTRIB_DLLEXPORT size_t VQUniqueCounts(const int64_t* keys, size_t n,
+                                             int64_t* unique,
+                                             uint64_t* HWY_RESTRICT counts);
+HWY_CONTRIB_DLLEXPORT size_t VQUniqueCounts(const double* keys, size_t n,
+                                             double* unique,
+                                             uint64_t* HWY_RESTRICT counts);
+
+// Vectorized top-k: writes to out[0, min(k, n)) the smallest (SortAscending)
+// or largest (SortDescending) keys of keys[0, n) in that order, and optionally
+// their indices. `keys` are not modified, and only one pass over them is
+// required: keys are compared with the current k-th key, and those that would
+// replace it are compressed into a buffer, which is reduced to k keys once it
+// holds max(2k, several vectors). Hence this is much faster than sorting or
+// VQSelect when k is much smaller than n. Equivalent keys are taken in order
+// of their index, -0.0 and +0.0 are equivalent and NaN follow all other keys,
+// as in VQArgSort. The uint32_t overloads require n <= 2^32. Allocates 16
+// bytes per key of the buffer.
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint32_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint32_t* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint32_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint32_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint32_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint32_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int32_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int32_t* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int32_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int32_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int32_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int32_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int32_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const float* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  float* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const float* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  float* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const float* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  float* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const float* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  float* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const float* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  float* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const float* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  float* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint64_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint64_t* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint64_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint64_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint64_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const uint64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  uint64_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int64_t* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int64_t* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int64_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int64_t* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int64_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const int64_t* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  int64_t* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const double* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  double* HWY_RESTRICT out, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const double* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  double* HWY_RESTRICT out, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const double* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  double* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const double* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  double* HWY_RESTRICT out,
+                                  uint32_t* HWY_RESTRICT indices,
+                                  SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const double* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  double* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQTopK(const double* HWY_RESTRICT keys,
+                                  const size_t n, const size_t k,
+                                  double* HWY_RESTRICT out,
+                                  uint64_t* HWY_RESTRICT indices,
+                                  SortDescending);
+
+// Type of the key within each record passed to VQSortBy.
+enum class SortKeyType { kU32, kI32, kF32, kU64, kI64, kF64 };
+
+// Stable sort of n records of record_bytes each, for example structs, by the
+// key of type key_type at byte offset key_offset within each record. Records
+// need not be aligned. Keys are compared as in VQArgSort. This computes the
+// argsort of the keys and then moves each record once, which is faster than
+// sorting the records directly. Allocates a copy of the records, plus the
+// keys, indices and the VQArgSort buffer.
+HWY_CONTRIB_DLLEXPORT void VQSortBy(void* HWY_RESTRICT records, size_t n,
+                                    size_t record_bytes, size_t key_offset,
+                                    SortKeyType key_type, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortBy(void* HWY_RESTRICT records, size_t n,
+                                    size_t record_bytes, size_t key_offset,
+                                    SortKeyType key_type, SortDescending);
+
+// Sorts each of the segments keys[offsets[i], offsets[i + 1]) for i in
+// [0, num_segments), where offsets is non-decreasing and has num_segments + 1
+// entries. Segments that fit in the base case skip the per-call checks of
+// VQSort, but are still sorted one at a time. On SSE2, segments of up to 512
+// keys are about 7% faster than one VQSort call per segment, and segments of
+// 16 to 32 keys are not faster. The ThreadPool overloads sort groups of
+// segments with similar total size in parallel.
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(float* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(float* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(float* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(float* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(double* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(double* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(double* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortAscending,
+                                          ThreadPool& pool);
+HWY_CONTRIB_DLLEXPORT void VQSortSegments(double* HWY_RESTRICT keys,
+                                          const size_t* HWY_RESTRICT offsets,
+                                          size_t num_segments, SortDescending,
+                                          ThreadPool& pool);
+
+// Byte string referenced by VQSortStrings, which only reorders these spans and
+// does not copy or modify the bytes.
+struct SortString {
+  const uint8_t* data;
+  size_t size;
+};
+
+// Sorts n strings in lexicographic order: by the first differing byte, as
+// unsigned like memcmp, and otherwise by size, so a prefix precedes the longer
+// string. Not stable. Strings are first sorted by their leading 8 bytes via
+// VQSort of K64V64; each group with equal bytes is then sorted by the next 8,
+// as in multikey quicksort. Cost is thus proportional to the length of the
+// distinguishing prefixes. Allocates 16 + sizeof(SortString) bytes per string.
+HWY_CONTRIB_DLLEXPORT void VQSortStrings(SortString* HWY_RESTRICT strings,
+                                         size_t n, SortAscending);
+HWY_CONTRIB_DLLEXPORT void VQSortStrings(SortString* HWY_RESTRICT strings,
+                                         size_t n, SortDescending);
+
+// Pointer to the VQSort implementation for the best available target.
+template <typename T>
+using VQSortFunc = void (*)(T* HWY_RESTRICT keys, size_t n);
+
+// Returns the function that VQSort(keys, n, Order()) would dispatch to. The
+// pointer argument only selects the key type and may be null. Unlike VQSort,
+// the result is not updated if the chosen target later changes, e.g. in tests.
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint16_t> GetVQSortFunc(uint16_t*,
+                                                         SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint16_t> GetVQSortFunc(uint16_t*,
+                                                         SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint32_t> GetVQSortFunc(uint32_t*,
+                                                         SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint32_t> GetVQSortFunc(uint32_t*,
+                                                         SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint64_t> GetVQSortFunc(uint64_t*,
+                                                         SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint64_t> GetVQSortFunc(uint64_t*,
+                                                         SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<int16_t> GetVQSortFunc(int16_t*,
+                                                        SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<int16_t> GetVQSortFunc(int16_t*,
+                                                        SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<int32_t> GetVQSortFunc(int32_t*,
+                                                        SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<int32_t> GetVQSortFunc(int32_t*,
+                                                        SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<int64_t> GetVQSortFunc(int64_t*,
+                                                        SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<int64_t> GetVQSortFunc(int64_t*,
+                                                        SortDescending);
+// The returned functions must only be called if hwy::HaveFloat16() is true.
+HWY_CONTRIB_DLLEXPORT VQSortFunc<float16_t> GetVQSortFunc(float16_t*,
+                                                          SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<float16_t> GetVQSortFunc(float16_t*,
+                                                          SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<float> GetVQSortFunc(float*, SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<float> GetVQSortFunc(float*, SortDescending);
+// The returned functions must only be called if hwy::HaveFloat64() is true.
+HWY_CONTRIB_DLLEXPORT VQSortFunc<double> GetVQSortFunc(double*, SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<double> GetVQSortFunc(double*,
+                                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint128_t> GetVQSortFunc(uint128_t*,
+                                                          SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<uint128_t> GetVQSortFunc(uint128_t*,
+                                                          SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<K64V64> GetVQSortFunc(K64V64*, SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<K64V64> GetVQSortFunc(K64V64*,
+                                                       SortDescending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<K32V32> GetVQSortFunc(K32V32*, SortAscending);
+HWY_CONTRIB_DLLEXPORT VQSortFunc<K32V32> GetVQSortFunc(K32V32*,
+                                                       SortDescending);
+
+// Same as VQSort(keys, n, Order()), but resolves the target once, when
+// constructed. Each call then skips the dynamic dispatch, which is helpful when
+// sorting many small arrays, e.g. in a loop. Arrays that fit in the sorting
+// network base case (e.g. 64 32-bit keys on SSE4, 256 on AVX-512) are sorted
+// without drawing samples or touching the random state. The same restrictions
+// on float16_t and double apply as for VQSort.
+template <typename T, class Order>
+class VQSorter {
+ public:
+  VQSorter() : func_(GetVQSortFunc(static_cast<T*>(nullptr), Order())) {}
+
+  void operator()(T* HWY_RESTRICT keys, size_t n) const { func_(keys, n); }
+
+ private:
+  VQSortFunc<T> func_;
+};
+
 // User-level caching is no longer required, so this class is no longer
 // beneficial. We recommend using the simpler VQSort() interface instead, and
 // retain this class only for compatibility. It now just calls VQSort.
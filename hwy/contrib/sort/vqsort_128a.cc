@@ -30,6 +30,11 @@ void Sort128Asc(uint128_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSort128Asc(uint128_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSort128Asc(uint128_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(Sort128Asc);
+HWY_EXPORT(ParallelSort128Asc);
 HWY_EXPORT(PartialSort128Asc);
 HWY_EXPORT(Select128Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(Sort128Asc)(keys, n);
 }
 
+void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSort128Asc)(keys, n, pool);
+}
+
 void VQPartialSort(uint128_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSort128Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint128_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(Select128Asc)(keys, n, k);
 }
 
+VQSortFunc<uint128_t> GetVQSortFunc(uint128_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(Sort128Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
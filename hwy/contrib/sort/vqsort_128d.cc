@@ -30,6 +30,11 @@ void Sort128Desc(uint128_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSort128Desc(uint128_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSort128Desc(uint128_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(Sort128Desc);
+HWY_EXPORT(ParallelSort128Desc);
 HWY_EXPORT(PartialSort128Desc);
 HWY_EXPORT(Select128Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(Sort128Desc)(keys, n);
 }
 
+void VQSort(uint128_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSort128Desc)(keys, n, pool);
+}
+
 void VQPartialSort(uint128_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSort128Desc)(keys, k, n);
@@ -67,5 +78,10 @@ void VQSelect(uint128_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(Select128Desc)(keys, k, n);
 }
 
+VQSortFunc<uint128_t> GetVQSortFunc(uint128_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(Sort128Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
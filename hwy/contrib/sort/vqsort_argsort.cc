@@ -0,0 +1,495 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Stable argsort and key-value sort. Each key is converted to an unsigned rank
+// and packed together with its index into a 64 or 128-bit lane, which are then
+// sorted with VQSort. Because the index breaks ties, the result is stable.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"  // VQArgSort
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_argsort.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/contrib/sort/rank-inl.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Packs a 32-bit rank and 32-bit index into each u64 lane. Requires
+// num <= 2^32.
+template <class Order, typename T, typename TI>
+void ArgSort64(const T* HWY_RESTRICT keys, const size_t num,
+               TI* HWY_RESTRICT indices) {
+  const ScalableTag<uint64_t> d64;
+  using V64 = Vec<decltype(d64)>;
+  const Rebind<MakeUnsigned<T>, decltype(d64)> du;
+  const size_t N = Lanes(d64);
+
+  // Padded so that we can store whole vectors.
+  AlignedFreeUniquePtr<uint64_t[]> packed =
+      AllocateAligned<uint64_t>(RoundUpTo(num, N));
+  HWY_ASSERT(packed);
+
+  V64 idx = Iota(d64, 0);
+  const V64 vN = Set(d64, static_cast<uint64_t>(N));
+  for (size_t i = 0; i < num; i += N) {
+    const V64 rank = PromoteTo(
+        d64, KeyRank<Order, T>(du, LoadKeyBits(d64, keys + i, num - i)));
+    Store(Or(ShiftLeft<32>(rank), idx), d64, packed.get() + i);
+    idx = Add(idx, vN);
+  }
+
+  VQSort(packed.get(), num, SortAscending());
+
+  const V64 lower = Set(d64, uint64_t{0xFFFFFFFFu});
+  for (size_t i = 0; i < num; i += N) {
+    StoreIndices(d64, And(Load(d64, packed.get() + i), lower), indices + i,
+                 num - i);
+  }
+}
+
+// Packs a 32 or 64-bit rank (upper half) and 64-bit index (lower half) into
+// each 128-bit key.
+template <class Order, typename T, typename TI>
+void ArgSort128(const T* HWY_RESTRICT keys, const size_t num,
+                TI* HWY_RESTRICT indices) {
+  const ScalableTag<uint64_t> d64;
+  using V64 = Vec<decltype(d64)>;
+  const Rebind<MakeUnsigned<T>, decltype(d64)> du;
+  const size_t N = Lanes(d64);
+
+  AlignedFreeUniquePtr<uint64_t[]> packed =
+      AllocateAligned<uint64_t>(2 * RoundUpTo(num, N));
+  HWY_ASSERT(packed);
+
+  V64 idx = Iota(d64, 0);
+  const V64 vN = Set(d64, static_cast<uint64_t>(N));
+  for (size_t i = 0; i < num; i += N) {
+    const V64 rank = WidenRank(
+        d64, KeyRank<Order, T>(du, LoadKeyBits(d64, keys + i, num - i)));
+    StoreInterleaved2(idx, rank, d64, packed.get() + 2 * i);
+    idx = Add(idx, vN);
+  }
+
+  VQSort(reinterpret_cast<uint128_t*>(packed.get()), num, SortAscending());
+
+  for (size_t i = 0; i < num; i += N) {
+    V64 rank;
+    LoadInterleaved2(d64, packed.get() + 2 * i, idx, rank);
+    StoreIndices(d64, idx, indices + i, num - i);
+  }
+}
+
+// 32-bit keys: prefer the half-size packing unless indices do not fit.
+template <class Order, typename T, typename TI>
+void ArgSort(const T* HWY_RESTRICT keys, const size_t num,
+             TI* HWY_RESTRICT indices, hwy::SizeTag<4> /* key_size */) {
+  if (static_cast<uint64_t>(num) <= (1ull << 32)) {
+    ArgSort64<Order>(keys, num, indices);
+  } else {
+    ArgSort128<Order>(keys, num, indices);
+  }
+}
+
+template <class Order, typename T, typename TI>
+void ArgSort(const T* HWY_RESTRICT keys, const size_t num,
+             TI* HWY_RESTRICT indices, hwy::SizeTag<8> /* key_size */) {
+  ArgSort128<Order>(keys, num, indices);
+}
+
+template <class Order, typename T, typename TI>
+void ArgSort(const T* HWY_RESTRICT keys, const size_t num,
+             TI* HWY_RESTRICT indices) {
+  HWY_DASSERT(num == 0 || static_cast<uint64_t>(num - 1) <= LimitsMax<TI>());
+  if (num <= 1) {
+    if (num == 1) indices[0] = 0;
+    return;
+  }
+  ArgSort<Order>(keys, num, indices, hwy::SizeTag<sizeof(T)>());
+}
+
+// Sorts K32V32 (TL = uint32_t) or K64V64 (TL = uint64_t) by key while keeping
+// equivalent keys in their original order. The value lane is temporarily
+// replaced by the index, which requires num <= 2^32 for K32V32.
+template <class Order, typename TL, class KV>
+void StableSortPairs(KV* HWY_RESTRICT pairs, const size_t num) {
+  static_assert(sizeof(KV) == 2 * sizeof(TL), "Pair must consist of two lanes");
+  using TP = hwy::If<sizeof(TL) == 4, uint64_t, uint128_t>;
+  HWY_DASSERT(num == 0 || static_cast<uint64_t>(num - 1) <= LimitsMax<TL>());
+  if (num <= 1) return;
+
+  const ScalableTag<TL> d;
+  using V = Vec<decltype(d)>;
+  const size_t N = Lanes(d);
+  // Lane 2 * i is the value of pair i, and lane 2 * i + 1 its key.
+  TL* HWY_RESTRICT lanes = reinterpret_cast<TL*>(pairs);
+
+  AlignedFreeUniquePtr<TL[]> packed = AllocateAligned<TL>(2 * num);
+  HWY_ASSERT(packed);
+
+  V idx = Iota(d, 0);
+  const V vN = Set(d, static_cast<TL>(N));
+  size_t i = 0;
+  for (; i + N <= num; i += N) {
+    V values, keys;
+    LoadInterleaved2(d, lanes + 2 * i, values, keys);
+    StoreInterleaved2(idx, KeyRank<Order, TL>(d, keys), d,
+                      packed.get() + 2 * i);
+    idx = Add(idx, vN);
+  }
+  for (; i < num; ++i) {
+    const TL key = lanes[2 * i + 1];
+    packed[2 * i] = static_cast<TL>(i);
+    packed[2 * i + 1] = Order().IsAscending() ? key : static_cast<TL>(~key);
+  }
+
+  VQSort(reinterpret_cast<TP*>(packed.get()), num, SortAscending());
+
+  // The gather is random access and thus not worth vectorizing.
+  for (i = 0; i < num; ++i) {
+    const TL key = packed[2 * i + 1];
+    packed[2 * i] = lanes[2 * static_cast<size_t>(packed[2 * i])];
+    packed[2 * i + 1] = Order().IsAscending() ? key : static_cast<TL>(~key);
+  }
+  CopyBytes(packed.get(), pairs, num * sizeof(KV));
+}
+
+}  // namespace detail
+
+void ArgSortU32U32Asc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                      uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortU32U32Desc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                       uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortU32U64Asc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                      uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortU32U64Desc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                       uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortI32U32Asc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                      uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortI32U32Desc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                       uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortI32U64Asc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                      uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortI32U64Desc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                       uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortF32U32Asc(const float* HWY_RESTRICT keys, const size_t num,
+                      uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortF32U32Desc(const float* HWY_RESTRICT keys, const size_t num,
+                       uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortF32U64Asc(const float* HWY_RESTRICT keys, const size_t num,
+                      uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortF32U64Desc(const float* HWY_RESTRICT keys, const size_t num,
+                       uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortU64U32Asc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                      uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortU64U32Desc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                       uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortU64U64Asc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                      uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortU64U64Desc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                       uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortI64U32Asc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                      uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortI64U32Desc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                       uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortI64U64Asc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                      uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortI64U64Desc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                       uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortF64U32Asc(const double* HWY_RESTRICT keys, const size_t num,
+                      uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortF64U32Desc(const double* HWY_RESTRICT keys, const size_t num,
+                       uint32_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void ArgSortF64U64Asc(const double* HWY_RESTRICT keys, const size_t num,
+                      uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortAscending>(keys, num, indices);
+}
+
+void ArgSortF64U64Desc(const double* HWY_RESTRICT keys, const size_t num,
+                       uint64_t* HWY_RESTRICT indices) {
+  detail::ArgSort<SortDescending>(keys, num, indices);
+}
+
+void StableSortKV64Asc(K32V32* HWY_RESTRICT keys, const size_t num) {
+  detail::StableSortPairs<SortAscending, uint32_t>(keys, num);
+}
+
+void StableSortKV64Desc(K32V32* HWY_RESTRICT keys, const size_t num) {
+  detail::StableSortPairs<SortDescending, uint32_t>(keys, num);
+}
+
+void StableSortKV128Asc(K64V64* HWY_RESTRICT keys, const size_t num) {
+  detail::StableSortPairs<SortAscending, uint64_t>(keys, num);
+}
+
+void StableSortKV128Desc(K64V64* HWY_RESTRICT keys, const size_t num) {
+  detail::StableSortPairs<SortDescending, uint64_t>(keys, num);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(ArgSortU32U32Asc);
+HWY_EXPORT(ArgSortU32U32Desc);
+HWY_EXPORT(ArgSortU32U64Asc);
+HWY_EXPORT(ArgSortU32U64Desc);
+HWY_EXPORT(ArgSortI32U32Asc);
+HWY_EXPORT(ArgSortI32U32Desc);
+HWY_EXPORT(ArgSortI32U64Asc);
+HWY_EXPORT(ArgSortI32U64Desc);
+HWY_EXPORT(ArgSortF32U32Asc);
+HWY_EXPORT(ArgSortF32U32Desc);
+HWY_EXPORT(ArgSortF32U64Asc);
+HWY_EXPORT(ArgSortF32U64Desc);
+HWY_EXPORT(ArgSortU64U32Asc);
+HWY_EXPORT(ArgSortU64U32Desc);
+HWY_EXPORT(ArgSortU64U64Asc);
+HWY_EXPORT(ArgSortU64U64Desc);
+HWY_EXPORT(ArgSortI64U32Asc);
+HWY_EXPORT(ArgSortI64U32Desc);
+HWY_EXPORT(ArgSortI64U64Asc);
+HWY_EXPORT(ArgSortI64U64Desc);
+HWY_EXPORT(ArgSortF64U32Asc);
+HWY_EXPORT(ArgSortF64U32Desc);
+HWY_EXPORT(ArgSortF64U64Asc);
+HWY_EXPORT(ArgSortF64U64Desc);
+HWY_EXPORT(StableSortKV64Asc);
+HWY_EXPORT(StableSortKV64Desc);
+HWY_EXPORT(StableSortKV128Asc);
+HWY_EXPORT(StableSortKV128Desc);
+}  // namespace
+
+void VQArgSort(const uint32_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU32U32Asc)(keys, n, indices);
+}
+
+void VQArgSort(const uint32_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU32U32Desc)(keys, n, indices);
+}
+
+void VQArgSort(const uint32_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU32U64Asc)(keys, n, indices);
+}
+
+void VQArgSort(const uint32_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU32U64Desc)(keys, n, indices);
+}
+
+void VQArgSort(const int32_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI32U32Asc)(keys, n, indices);
+}
+
+void VQArgSort(const int32_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI32U32Desc)(keys, n, indices);
+}
+
+void VQArgSort(const int32_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI32U64Asc)(keys, n, indices);
+}
+
+void VQArgSort(const int32_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI32U64Desc)(keys, n, indices);
+}
+
+void VQArgSort(const float* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF32U32Asc)(keys, n, indices);
+}
+
+void VQArgSort(const float* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF32U32Desc)(keys, n, indices);
+}
+
+void VQArgSort(const float* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF32U64Asc)(keys, n, indices);
+}
+
+void VQArgSort(const float* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF32U64Desc)(keys, n, indices);
+}
+
+void VQArgSort(const uint64_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU64U32Asc)(keys, n, indices);
+}
+
+void VQArgSort(const uint64_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU64U32Desc)(keys, n, indices);
+}
+
+void VQArgSort(const uint64_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU64U64Asc)(keys, n, indices);
+}
+
+void VQArgSort(const uint64_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortU64U64Desc)(keys, n, indices);
+}
+
+void VQArgSort(const int64_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI64U32Asc)(keys, n, indices);
+}
+
+void VQArgSort(const int64_t* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI64U32Desc)(keys, n, indices);
+}
+
+void VQArgSort(const int64_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI64U64Asc)(keys, n, indices);
+}
+
+void VQArgSort(const int64_t* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortI64U64Desc)(keys, n, indices);
+}
+
+void VQArgSort(const double* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF64U32Asc)(keys, n, indices);
+}
+
+void VQArgSort(const double* HWY_RESTRICT keys, const size_t n,
+               uint32_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF64U32Desc)(keys, n, indices);
+}
+
+void VQArgSort(const double* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF64U64Asc)(keys, n, indices);
+}
+
+void VQArgSort(const double* HWY_RESTRICT keys, const size_t n,
+               uint64_t* HWY_RESTRICT indices, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(ArgSortF64U64Desc)(keys, n, indices);
+}
+
+void VQStableSort(K32V32* HWY_RESTRICT keys, const size_t n, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(StableSortKV64Asc)(keys, n);
+}
+
+void VQStableSort(K32V32* HWY_RESTRICT keys, const size_t n, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(StableSortKV64Desc)(keys, n);
+}
+
+void VQStableSort(K64V64* HWY_RESTRICT keys, const size_t n, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(StableSortKV128Asc)(keys, n);
+}
+
+void VQStableSort(K64V64* HWY_RESTRICT keys, const size_t n, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(StableSortKV128Desc)(keys, n);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
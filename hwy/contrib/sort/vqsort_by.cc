@@ -0,0 +1,175 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sorting of records by an embedded key: the keys are copied to a contiguous
+// array, VQArgSort computes the permutation, and the records are then gathered
+// into a buffer and copied back. This moves each record only twice, whereas
+// sorting the records directly would move them O(log n) times.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/cache_control.h"  // Prefetch
+#include "hwy/contrib/sort/vqsort.h"
+
+namespace hwy {
+namespace {
+
+// How many records ahead of the current one to prefetch. The gather reads
+// records in random order, so the hardware prefetcher does not help.
+constexpr size_t kPrefetchRecords = 8;
+
+template <typename T>
+AlignedFreeUniquePtr<T[]> ExtractKeys(const uint8_t* HWY_RESTRICT records,
+                                      size_t n, size_t record_bytes,
+                                      size_t key_offset) {
+  AlignedFreeUniquePtr<T[]> keys = AllocateAligned<T>(n);
+  HWY_ASSERT(keys);
+  const uint8_t* HWY_RESTRICT key = records + key_offset;
+  for (size_t i = 0; i < n; ++i) {
+    CopyBytes<sizeof(T)>(key + i * record_bytes, &keys[i]);
+  }
+  return keys;
+}
+
+// Writes records[indices[i]] to out[i]. The size is known at compile time,
+// which enables vector copies.
+template <size_t kRecordBytes, typename TI>
+void GatherRecords(const uint8_t* HWY_RESTRICT records,
+                   const TI* HWY_RESTRICT indices, size_t n,
+                   uint8_t* HWY_RESTRICT out) {
+  size_t i = 0;
+  for (; i + kPrefetchRecords < n; ++i) {
+    Prefetch(records + indices[i + kPrefetchRecords] * kRecordBytes);
+    CopyBytes<kRecordBytes>(records + indices[i] * kRecordBytes,
+                            out + i * kRecordBytes);
+  }
+  for (; i < n; ++i) {
+    CopyBytes<kRecordBytes>(records + indices[i] * kRecordBytes,
+                            out + i * kRecordBytes);
+  }
+}
+
+// As above, for other sizes.
+template <typename TI>
+void GatherRecords(const uint8_t* HWY_RESTRICT records,
+                   const TI* HWY_RESTRICT indices, size_t n,
+                   size_t record_bytes, uint8_t* HWY_RESTRICT out) {
+  for (size_t i = 0; i < n; ++i) {
+    if (i + kPrefetchRecords < n) {
+      Prefetch(records + indices[i + kPrefetchRecords] * record_bytes);
+    }
+    CopyBytes(records + indices[i] * record_bytes, out + i * record_bytes,
+              record_bytes);
+  }
+}
+
+// Reorders `records` such that the i-th is the former records[indices[i]].
+template <typename TI>
+void PermuteRecords(uint8_t* HWY_RESTRICT records,
+                    const TI* HWY_RESTRICT indices, size_t n,
+                    size_t record_bytes) {
+  AlignedFreeUniquePtr<uint8_t[]> buf =
+      AllocateAligned<uint8_t>(n * record_bytes);
+  HWY_ASSERT(buf);
+  uint8_t* HWY_RESTRICT out = buf.get();
+  switch (record_bytes) {
+    case 8:
+      GatherRecords<8>(records, indices, n, out);
+      break;
+    case 16:
+      GatherRecords<16>(records, indices, n, out);
+      break;
+    case 24:
+      GatherRecords<24>(records, indices, n, out);
+      break;
+    case 32:
+      GatherRecords<32>(records, indices, n, out);
+      break;
+    case 48:
+      GatherRecords<48>(records, indices, n, out);
+      break;
+    case 64:
+      GatherRecords<64>(records, indices, n, out);
+      break;
+    default:
+      GatherRecords(records, indices, n, record_bytes, out);
+      break;
+  }
+  CopyBytes(out, records, n * record_bytes);
+}
+
+template <typename T, typename TI, class Order>
+void SortByWithIndex(uint8_t* HWY_RESTRICT records, size_t n,
+                     size_t record_bytes, size_t key_offset, Order order) {
+  AlignedFreeUniquePtr<TI[]> indices = AllocateAligned<TI>(n);
+  HWY_ASSERT(indices);
+  {
+    const AlignedFreeUniquePtr<T[]> keys =
+        ExtractKeys<T>(records, n, record_bytes, key_offset);
+    VQArgSort(keys.get(), n, indices.get(), order);
+  }  // Free keys before allocating the buffer for the records.
+  PermuteRecords(records, indices.get(), n, record_bytes);
+}
+
+template <typename T, class Order>
+void SortByKey(uint8_t* HWY_RESTRICT records, size_t n, size_t record_bytes,
+               size_t key_offset, Order order) {
+  HWY_ASSERT(key_offset + sizeof(T) <= record_bytes);
+  // 32-bit indices halve the size of the index array.
+  if (n <= static_cast<size_t>(LimitsMax<uint32_t>())) {
+    SortByWithIndex<T, uint32_t>(records, n, record_bytes, key_offset, order);
+  } else {
+    SortByWithIndex<T, uint64_t>(records, n, record_bytes, key_offset, order);
+  }
+}
+
+template <class Order>
+void SortBy(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+            size_t key_offset, SortKeyType key_type, Order order) {
+  if (n <= 1) return;
+  uint8_t* HWY_RESTRICT bytes = static_cast<uint8_t*>(records);
+  switch (key_type) {
+    case SortKeyType::kU32:
+      return SortByKey<uint32_t>(bytes, n, record_bytes, key_offset, order);
+    case SortKeyType::kI32:
+      return SortByKey<int32_t>(bytes, n, record_bytes, key_offset, order);
+    case SortKeyType::kF32:
+      return SortByKey<float>(bytes, n, record_bytes, key_offset, order);
+    case SortKeyType::kU64:
+      return SortByKey<uint64_t>(bytes, n, record_bytes, key_offset, order);
+    case SortKeyType::kI64:
+      return SortByKey<int64_t>(bytes, n, record_bytes, key_offset, order);
+    case SortKeyType::kF64:
+      return SortByKey<double>(bytes, n, record_bytes, key_offset, order);
+  }
+  HWY_ABORT("Invalid key type %d", static_cast<int>(key_type));
+}
+
+}  // namespace
+
+void VQSortBy(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+              size_t key_offset, SortKeyType key_type, SortAscending order) {
+  SortBy(records, n, record_bytes, key_offset, key_type, order);
+}
+
+void VQSortBy(void* HWY_RESTRICT records, size_t n, size_t record_bytes,
+              size_t key_offset, SortKeyType key_type, SortDescending order) {
+  SortBy(records, n, record_bytes, key_offset, key_type, order);
+}
+
+}  // namespace hwy
@@ -36,6 +36,18 @@ void SortF16Asc(float16_t* HWY_RESTRICT keys, const size_t num) {
 #endif
 }
 
+void ParallelSortF16Asc(float16_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+#if HWY_HAVE_FLOAT16
+  return VQSortStatic(keys, num, SortAscending(), pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif
+}
+
 void PartialSortF16Asc(float16_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
 #if HWY_HAVE_FLOAT16
@@ -69,6 +81,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF16Asc);
+HWY_EXPORT(ParallelSortF16Asc);
 HWY_EXPORT(PartialSortF16Asc);
 HWY_EXPORT(SelectF16Asc);
 }  // namespace
@@ -77,6 +90,11 @@ void VQSort(float16_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortF16Asc)(keys, n);
 }
 
+void VQSort(float16_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF16Asc)(keys, n, pool);
+}
+
 void VQPartialSort(float16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortF16Asc)(keys, n, k);
@@ -87,5 +105,10 @@ void VQSelect(float16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectF16Asc)(keys, n, k);
 }
 
+VQSortFunc<float16_t> GetVQSortFunc(float16_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortF16Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -36,6 +36,18 @@ void SortF16Desc(float16_t* HWY_RESTRICT keys, const size_t num) {
 #endif
 }
 
+void ParallelSortF16Desc(float16_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+#if HWY_HAVE_FLOAT16
+  return VQSortStatic(keys, num, SortDescending(), pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif
+}
+
 void PartialSortF16Desc(float16_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
 #if HWY_HAVE_FLOAT16
@@ -69,6 +81,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF16Desc);
+HWY_EXPORT(ParallelSortF16Desc);
 HWY_EXPORT(PartialSortF16Desc);
 HWY_EXPORT(SelectF16Desc);
 }  // namespace
@@ -77,6 +90,11 @@ void VQSort(float16_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortF16Desc)(keys, n);
 }
 
+void VQSort(float16_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF16Desc)(keys, n, pool);
+}
+
 void VQPartialSort(float16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortF16Desc)(keys, n, k);
@@ -87,5 +105,10 @@ void VQSelect(float16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectF16Desc)(keys, n, k);
 }
 
+VQSortFunc<float16_t> GetVQSortFunc(float16_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortF16Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortF32Asc(float* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortF32Asc(float* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortF32Asc(float* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -48,6 +53,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF32Asc);
+HWY_EXPORT(ParallelSortF32Asc);
 HWY_EXPORT(PartialSortF32Asc);
 HWY_EXPORT(SelectF32Asc);
 }  // namespace
@@ -56,6 +62,11 @@ void VQSort(float* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortF32Asc)(keys, n);
 }
 
+void VQSort(float* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF32Asc)(keys, n, pool);
+}
+
 void VQPartialSort(float* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortF32Asc)(keys, n, k);
@@ -66,5 +77,10 @@ void VQSelect(float* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectF32Asc)(keys, n, k);
 }
 
+VQSortFunc<float> GetVQSortFunc(float*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortF32Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortF32Desc(float* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortF32Desc(float* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortF32Desc(float* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -48,6 +53,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF32Desc);
+HWY_EXPORT(ParallelSortF32Desc);
 HWY_EXPORT(PartialSortF32Desc);
 HWY_EXPORT(SelectF32Desc);
 }  // namespace
@@ -56,6 +62,11 @@ void VQSort(float* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortF32Desc)(keys, n);
 }
 
+void VQSort(float* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF32Desc)(keys, n, pool);
+}
+
 void VQPartialSort(float* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortF32Desc)(keys, n, k);
@@ -66,5 +77,10 @@ void VQSelect(float* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectF32Desc)(keys, n, k);
 }
 
+VQSortFunc<float> GetVQSortFunc(float*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortF32Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -36,6 +36,18 @@ void SortF64Asc(double* HWY_RESTRICT keys, const size_t num) {
 #endif
 }
 
+void ParallelSortF64Asc(double* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+#if HWY_HAVE_FLOAT64
+  return VQSortStatic(keys, num, SortAscending(), pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif
+}
+
 void PartialSortF64Asc(double* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
 #if HWY_HAVE_FLOAT64
@@ -68,6 +80,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF64Asc);
+HWY_EXPORT(ParallelSortF64Asc);
 HWY_EXPORT(PartialSortF64Asc);
 HWY_EXPORT(SelectF64Asc);
 }  // namespace
@@ -76,6 +89,11 @@ void VQSort(double* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortF64Asc)(keys, n);
 }
 
+void VQSort(double* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF64Asc)(keys, n, pool);
+}
+
 void VQPartialSort(double* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortF64Asc)(keys, n, k);
@@ -86,5 +104,10 @@ void VQSelect(double* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectF64Asc)(keys, n, k);
 }
 
+VQSortFunc<double> GetVQSortFunc(double*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortF64Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
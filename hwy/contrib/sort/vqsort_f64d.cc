@@ -36,6 +36,18 @@ void SortF64Desc(double* HWY_RESTRICT keys, const size_t num) {
 #endif
 }
 
+void ParallelSortF64Desc(double* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+#if HWY_HAVE_FLOAT64
+  return VQSortStatic(keys, num, SortDescending(), pool);
+#else
+  (void)keys;
+  (void)num;
+  (void)pool;
+  HWY_ASSERT(0);
+#endif
+}
+
 void PartialSortF64Desc(double* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
 #if HWY_HAVE_FLOAT64
@@ -69,6 +81,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortF64Desc);
+HWY_EXPORT(ParallelSortF64Desc);
 HWY_EXPORT(PartialSortF64Desc);
 HWY_EXPORT(SelectF64Desc);
 }  // namespace
@@ -77,6 +90,11 @@ void VQSort(double* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortF64Desc)(keys, n);
 }
 
+void VQSort(double* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortF64Desc)(keys, n, pool);
+}
+
 void VQPartialSort(double* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortF64Desc)(keys, n, k);
@@ -87,5 +105,10 @@ void VQSelect(double* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectF64Desc)(keys, n, k);
 }
 
+VQSortFunc<double> GetVQSortFunc(double*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortF64Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -0,0 +1,167 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sorting of floating-point keys with control over NaN placement. The keys are
+// transformed in place into unsigned integers whose order matches IEEE 754
+// totalOrder, sorted with the unsigned VQSort, and transformed back. Only
+// integer operations are used, so this also works without HWY_HAVE_FLOAT64.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"  // VQSort
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_float.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Key to which all NaN are mapped if `nan` is kFirst or kLast. The keys of
+// other values lie strictly between zero and the maximum.
+template <typename TU>
+TU NaNKey(SortNaN nan, bool ascending) {
+  return ((nan == SortNaN::kFirst) == ascending) ? TU{0} : LimitsMax<TU>();
+}
+
+// Negative values have all bits flipped, others only the sign bit. The result
+// is ordered like IEEE 754 totalOrder when compared as unsigned.
+template <typename T, class DU, class VU = Vec<DU>>
+HWY_INLINE VU KeyFromFloatBits(DU du, VU bits, bool replace_nan, VU nan_key) {
+  const RebindToSigned<DU> di;
+  const VU sign = Set(du, SignMask<T>());
+  const VU negative = BitCast(du, BroadcastSignBit(BitCast(di, bits)));
+  const VU key = Xor(bits, Or(negative, sign));
+  if (!replace_nan) return key;
+  const VU abs = AndNot(sign, bits);
+  const auto is_nan = Gt(abs, Set(du, ExponentMask<T>()));
+  return IfThenElse(is_nan, nan_key, key);
+}
+
+// Inverse of KeyFromFloatBits, except that nan_key becomes the canonical NaN.
+template <typename T, class DU, class VU = Vec<DU>>
+HWY_INLINE VU FloatBitsFromKey(DU du, VU key, bool replace_nan, VU nan_key) {
+  const RebindToSigned<DU> di;
+  const VU sign = Set(du, SignMask<T>());
+  // The sign bit of the key is set iff the value was non-negative.
+  const VU negative = Not(BitCast(du, BroadcastSignBit(BitCast(di, key))));
+  const VU bits = Xor(key, Or(negative, sign));
+  if (!replace_nan) return bits;
+  // Same bits as NaN(d) in VQSort, but without requiring a float vector.
+  const VU canonical_nan =
+      Set(du, static_cast<MakeUnsigned<T>>(LimitsMax<MakeSigned<T>>()));
+  return IfThenElse(Eq(key, nan_key), canonical_nan, bits);
+}
+
+template <typename T, class Order>
+void SortFloat(T* HWY_RESTRICT keys, size_t num, SortNaN nan, Order order) {
+  using TU = MakeUnsigned<T>;
+  const ScalableTag<TU> du;
+  using VU = Vec<decltype(du)>;
+  const size_t N = Lanes(du);
+  TU* HWY_RESTRICT lanes = reinterpret_cast<TU*>(keys);
+
+  const bool replace_nan = nan != SortNaN::kTotalOrder;
+  const VU nan_key = Set(du, NaNKey<TU>(nan, order.IsAscending()));
+
+  size_t i = 0;
+  for (; i + N <= num; i += N) {
+    const VU bits = LoadU(du, lanes + i);
+    StoreU(KeyFromFloatBits<T>(du, bits, replace_nan, nan_key), du, lanes + i);
+  }
+  const size_t remaining = num - i;
+  if (remaining != 0) {
+    const VU bits = LoadN(du, lanes + i, remaining);
+    StoreN(KeyFromFloatBits<T>(du, bits, replace_nan, nan_key), du, lanes + i,
+           remaining);
+  }
+
+  VQSort(lanes, num, order);
+
+  for (i = 0; i + N <= num; i += N) {
+    const VU key = LoadU(du, lanes + i);
+    StoreU(FloatBitsFromKey<T>(du, key, replace_nan, nan_key), du, lanes + i);
+  }
+  if (remaining != 0) {
+    const VU key = LoadN(du, lanes + i, remaining);
+    StoreN(FloatBitsFromKey<T>(du, key, replace_nan, nan_key), du, lanes + i,
+           remaining);
+  }
+}
+
+}  // namespace detail
+
+void SortNaNF32Asc(float* HWY_RESTRICT keys, size_t num, SortNaN nan) {
+  detail::SortFloat(keys, num, nan, SortAscending());
+}
+
+void SortNaNF32Desc(float* HWY_RESTRICT keys, size_t num, SortNaN nan) {
+  detail::SortFloat(keys, num, nan, SortDescending());
+}
+
+void SortNaNF64Asc(double* HWY_RESTRICT keys, size_t num, SortNaN nan) {
+  detail::SortFloat(keys, num, nan, SortAscending());
+}
+
+void SortNaNF64Desc(double* HWY_RESTRICT keys, size_t num, SortNaN nan) {
+  detail::SortFloat(keys, num, nan, SortDescending());
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(SortNaNF32Asc);
+HWY_EXPORT(SortNaNF32Desc);
+HWY_EXPORT(SortNaNF64Asc);
+HWY_EXPORT(SortNaNF64Desc);
+}  // namespace
+
+void VQSort(float* HWY_RESTRICT keys, const size_t n, SortAscending,
+            SortNaN nan) {
+  HWY_DYNAMIC_DISPATCH(SortNaNF32Asc)(keys, n, nan);
+}
+
+void VQSort(float* HWY_RESTRICT keys, const size_t n, SortDescending,
+            SortNaN nan) {
+  HWY_DYNAMIC_DISPATCH(SortNaNF32Desc)(keys, n, nan);
+}
+
+void VQSort(double* HWY_RESTRICT keys, const size_t n, SortAscending,
+            SortNaN nan) {
+  HWY_DYNAMIC_DISPATCH(SortNaNF64Asc)(keys, n, nan);
+}
+
+void VQSort(double* HWY_RESTRICT keys, const size_t n, SortDescending,
+            SortNaN nan) {
+  HWY_DYNAMIC_DISPATCH(SortNaNF64Desc)(keys, n, nan);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortI16Asc(int16_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortI16Asc(int16_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortI16Asc(int16_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI16Asc);
+HWY_EXPORT(ParallelSortI16Asc);
 HWY_EXPORT(PartialSortI16Asc);
 HWY_EXPORT(SelectI16Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(int16_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortI16Asc)(keys, n);
 }
 
+void VQSort(int16_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI16Asc)(keys, n, pool);
+}
+
 void VQPartialSort(int16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortI16Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(int16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectI16Asc)(keys, n, k);
 }
 
+VQSortFunc<int16_t> GetVQSortFunc(int16_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortI16Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
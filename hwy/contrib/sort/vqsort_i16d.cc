@@ -30,6 +30,11 @@ void SortI16Desc(int16_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortI16Desc(int16_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortI16Desc(int16_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI16Desc);
+HWY_EXPORT(ParallelSortI16Desc);
 HWY_EXPORT(PartialSortI16Desc);
 HWY_EXPORT(SelectI16Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(int16_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortI16Desc)(keys, n);
 }
 
+void VQSort(int16_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI16Desc)(keys, n, pool);
+}
+
 void VQPartialSort(int16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortI16Desc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(int16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectI16Desc)(keys, n, k);
 }
 
+VQSortFunc<int16_t> GetVQSortFunc(int16_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortI16Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortI32Asc(int32_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortI32Asc(int32_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortI32Asc(int32_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI32Asc);
+HWY_EXPORT(ParallelSortI32Asc);
 HWY_EXPORT(PartialSortI32Asc);
 HWY_EXPORT(SelectI32Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(int32_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortI32Asc)(keys, n);
 }
 
+void VQSort(int32_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI32Asc)(keys, n, pool);
+}
+
 void VQPartialSort(int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortI32Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectI32Asc)(keys, n, k);
 }
 
+VQSortFunc<int32_t> GetVQSortFunc(int32_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortI32Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortI32Desc(int32_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortI32Desc(int32_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortI32Desc(int32_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI32Desc);
+HWY_EXPORT(ParallelSortI32Desc);
 HWY_EXPORT(PartialSortI32Desc);
 HWY_EXPORT(SelectI32Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(int32_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortI32Desc)(keys, n);
 }
 
+void VQSort(int32_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI32Desc)(keys, n, pool);
+}
+
 void VQPartialSort(int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortI32Desc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectI32Desc)(keys, n, k);
 }
 
+VQSortFunc<int32_t> GetVQSortFunc(int32_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortI32Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortI64Asc(int64_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortI64Asc(int64_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortI64Asc(int64_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI64Asc);
+HWY_EXPORT(ParallelSortI64Asc);
 HWY_EXPORT(PartialSortI64Asc);
 HWY_EXPORT(SelectI64Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(int64_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortI64Asc)(keys, n);
 }
 
+void VQSort(int64_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI64Asc)(keys, n, pool);
+}
+
 void VQPartialSort(int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortI64Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectI64Asc)(keys, n, k);
 }
 
+VQSortFunc<int64_t> GetVQSortFunc(int64_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortI64Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortI64Desc(int64_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortI64Desc(int64_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortI64Desc(int64_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortI64Desc);
+HWY_EXPORT(ParallelSortI64Desc);
 HWY_EXPORT(PartialSortI64Desc);
 HWY_EXPORT(SelectI64Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(int64_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortI64Desc)(keys, n);
 }
 
+void VQSort(int64_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortI64Desc)(keys, n, pool);
+}
+
 void VQPartialSort(int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortI64Desc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectI64Desc)(keys, n, k);
 }
 
+VQSortFunc<int64_t> GetVQSortFunc(int64_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortI64Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -33,6 +33,11 @@ void SortKV128Asc(K64V64* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortKV128Asc(K64V64* HWY_RESTRICT keys, const size_t num,
+                          ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortKV128Asc(K64V64* HWY_RESTRICT keys, const size_t num,
                          const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -52,6 +57,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortKV128Asc);
+HWY_EXPORT(ParallelSortKV128Asc);
 HWY_EXPORT(PartialSortKV128Asc);
 HWY_EXPORT(SelectKV128Asc);
 }  // namespace
@@ -60,6 +66,11 @@ void VQSort(K64V64* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortKV128Asc)(keys, n);
 }
 
+void VQSort(K64V64* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortKV128Asc)(keys, n, pool);
+}
+
 void VQPartialSort(K64V64* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortKV128Asc)(keys, n, k);
@@ -70,5 +81,10 @@ void VQSelect(K64V64* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectKV128Asc)(keys, n, k);
 }
 
+VQSortFunc<K64V64> GetVQSortFunc(K64V64*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortKV128Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -33,6 +33,11 @@ void SortKV128Desc(K64V64* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortKV128Desc(K64V64* HWY_RESTRICT keys, const size_t num,
+                           ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortKV128Desc(K64V64* HWY_RESTRICT keys, const size_t num,
                           const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -52,6 +57,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortKV128Desc);
+HWY_EXPORT(ParallelSortKV128Desc);
 HWY_EXPORT(PartialSortKV128Desc);
 HWY_EXPORT(SelectKV128Desc);
 }  // namespace
@@ -60,6 +66,11 @@ void VQSort(K64V64* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortKV128Desc)(keys, n);
 }
 
+void VQSort(K64V64* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortKV128Desc)(keys, n, pool);
+}
+
 void VQPartialSort(K64V64* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortKV128Desc)(keys, n, k);
@@ -70,5 +81,10 @@ void VQSelect(K64V64* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectKV128Desc)(keys, n, k);
 }
 
+VQSortFunc<K64V64> GetVQSortFunc(K64V64*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortKV128Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -33,6 +33,11 @@ void SortKV64Asc(K32V32* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortKV64Asc(K32V32* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortKV64Asc(K32V32* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -52,6 +57,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortKV64Asc);
+HWY_EXPORT(ParallelSortKV64Asc);
 HWY_EXPORT(PartialSortKV64Asc);
 HWY_EXPORT(SelectKV64Asc);
 }  // namespace
@@ -60,6 +66,11 @@ void VQSort(K32V32* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortKV64Asc)(keys, n);
 }
 
+void VQSort(K32V32* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortKV64Asc)(keys, n, pool);
+}
+
 void VQPartialSort(K32V32* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortKV64Asc)(keys, n, k);
@@ -70,5 +81,10 @@ void VQSelect(K32V32* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectKV64Asc)(keys, n, k);
 }
 
+VQSortFunc<K32V32> GetVQSortFunc(K32V32*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortKV64Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
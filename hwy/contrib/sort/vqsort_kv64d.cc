@@ -33,6 +33,11 @@ void SortKV64Desc(K32V32* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortKV64Desc(K32V32* HWY_RESTRICT keys, const size_t num,
+                          ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortKV64Desc(K32V32* HWY_RESTRICT keys, const size_t num,
                          const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -52,6 +57,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortKV64Desc);
+HWY_EXPORT(ParallelSortKV64Desc);
 HWY_EXPORT(PartialSortKV64Desc);
 HWY_EXPORT(SelectKV64Desc);
 }  // namespace
@@ -60,6 +66,11 @@ void VQSort(K32V32* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortKV64Desc)(keys, n);
 }
 
+void VQSort(K32V32* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortKV64Desc)(keys, n, pool);
+}
+
 void VQPartialSort(K32V32* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortKV64Desc)(keys, n, k);
@@ -70,5 +81,10 @@ void VQSelect(K32V32* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectKV64Desc)(keys, n, k);
 }
 
+VQSortFunc<K32V32> GetVQSortFunc(K32V32*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortKV64Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
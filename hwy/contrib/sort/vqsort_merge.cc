@@ -0,0 +1,689 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+
+#include "hwy/contrib/sort/vqsort.h"  // VQMerge
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_merge.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/contrib/sort/merge-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+
+void MergeU16Asc(const uint16_t* HWY_RESTRICT a, size_t num_a,
+                 const uint16_t* HWY_RESTRICT b, size_t num_b,
+                 uint16_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsU16Asc(const uint16_t* const* runs, const size_t* num,
+                     size_t num_runs, uint16_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeU16Desc(const uint16_t* HWY_RESTRICT a, size_t num_a,
+                  const uint16_t* HWY_RESTRICT b, size_t num_b,
+                  uint16_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsU16Desc(const uint16_t* const* runs, const size_t* num,
+                      size_t num_runs, uint16_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeU32Asc(const uint32_t* HWY_RESTRICT a, size_t num_a,
+                 const uint32_t* HWY_RESTRICT b, size_t num_b,
+                 uint32_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsU32Asc(const uint32_t* const* runs, const size_t* num,
+                     size_t num_runs, uint32_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeU32Desc(const uint32_t* HWY_RESTRICT a, size_t num_a,
+                  const uint32_t* HWY_RESTRICT b, size_t num_b,
+                  uint32_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsU32Desc(const uint32_t* const* runs, const size_t* num,
+                      size_t num_runs, uint32_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeU64Asc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                 const uint64_t* HWY_RESTRICT b, size_t num_b,
+                 uint64_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsU64Asc(const uint64_t* const* runs, const size_t* num,
+                     size_t num_runs, uint64_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeU64Desc(const uint64_t* HWY_RESTRICT a, size_t num_a,
+                  const uint64_t* HWY_RESTRICT b, size_t num_b,
+                  uint64_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsU64Desc(const uint64_t* const* runs, const size_t* num,
+                      size_t num_runs, uint64_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeI16Asc(const int16_t* HWY_RESTRICT a, size_t num_a,
+                 const int16_t* HWY_RESTRICT b, size_t num_b,
+                 int16_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsI16Asc(const int16_t* const* runs, const size_t* num,
+                     size_t num_runs, int16_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeI16Desc(const int16_t* HWY_RESTRICT a, size_t num_a,
+                  const int16_t* HWY_RESTRICT b, size_t num_b,
+                  int16_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsI16Desc(const int16_t* const* runs, const size_t* num,
+                      size_t num_runs, int16_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeI32Asc(const int32_t* HWY_RESTRICT a, size_t num_a,
+                 const int32_t* HWY_RESTRICT b, size_t num_b,
+                 int32_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsI32Asc(const int32_t* const* runs, const size_t* num,
+                     size_t num_runs, int32_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeI32Desc(const int32_t* HWY_RESTRICT a, size_t num_a,
+                  const int32_t* HWY_RESTRICT b, size_t num_b,
+                  int32_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsI32Desc(const int32_t* const* runs, const size_t* num,
+                      size_t num_runs, int32_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeI64Asc(const int64_t* HWY_RESTRICT a, size_t num_a,
+                 const int64_t* HWY_RESTRICT b, size_t num_b,
+                 int64_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsI64Asc(const int64_t* const* runs, const size_t* num,
+                     size_t num_runs, int64_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeI64Desc(const int64_t* HWY_RESTRICT a, size_t num_a,
+                  const int64_t* HWY_RESTRICT b, size_t num_b,
+                  int64_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsI64Desc(const int64_t* const* runs, const size_t* num,
+                      size_t num_runs, int64_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeF16Asc(const float16_t* HWY_RESTRICT a, size_t num_a,
+                 const float16_t* HWY_RESTRICT b, size_t num_b,
+                 float16_t* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT16
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeRunsF16Asc(const float16_t* const* runs, const size_t* num,
+                     size_t num_runs, float16_t* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT16
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+#else
+  (void)runs;
+  (void)num;
+  (void)num_runs;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeF16Desc(const float16_t* HWY_RESTRICT a, size_t num_a,
+                  const float16_t* HWY_RESTRICT b, size_t num_b,
+                  float16_t* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT16
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeRunsF16Desc(const float16_t* const* runs, const size_t* num,
+                      size_t num_runs, float16_t* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT16
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+#else
+  (void)runs;
+  (void)num;
+  (void)num_runs;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeF32Asc(const float* HWY_RESTRICT a, size_t num_a,
+                 const float* HWY_RESTRICT b, size_t num_b,
+                 float* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsF32Asc(const float* const* runs, const size_t* num,
+                     size_t num_runs, float* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeF32Desc(const float* HWY_RESTRICT a, size_t num_a,
+                  const float* HWY_RESTRICT b, size_t num_b,
+                  float* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsF32Desc(const float* const* runs, const size_t* num,
+                      size_t num_runs, float* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeF64Asc(const double* HWY_RESTRICT a, size_t num_a,
+                 const double* HWY_RESTRICT b, size_t num_b,
+                 double* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT64
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeRunsF64Asc(const double* const* runs, const size_t* num,
+                     size_t num_runs, double* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT64
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+#else
+  (void)runs;
+  (void)num;
+  (void)num_runs;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeF64Desc(const double* HWY_RESTRICT a, size_t num_a,
+                  const double* HWY_RESTRICT b, size_t num_b,
+                  double* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT64
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+#else
+  (void)a;
+  (void)num_a;
+  (void)b;
+  (void)num_b;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void MergeRunsF64Desc(const double* const* runs, const size_t* num,
+                      size_t num_runs, double* HWY_RESTRICT out) {
+#if HWY_HAVE_FLOAT64
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+#else
+  (void)runs;
+  (void)num;
+  (void)num_runs;
+  (void)out;
+  HWY_ASSERT(0);
+#endif
+}
+
+void Merge128Asc(const uint128_t* HWY_RESTRICT a, size_t num_a,
+                 const uint128_t* HWY_RESTRICT b, size_t num_b,
+                 uint128_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRuns128Asc(const uint128_t* const* runs, const size_t* num,
+                     size_t num_runs, uint128_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void Merge128Desc(const uint128_t* HWY_RESTRICT a, size_t num_a,
+                  const uint128_t* HWY_RESTRICT b, size_t num_b,
+                  uint128_t* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRuns128Desc(const uint128_t* const* runs, const size_t* num,
+                      size_t num_runs, uint128_t* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeKV128Asc(const K64V64* HWY_RESTRICT a, size_t num_a,
+                   const K64V64* HWY_RESTRICT b, size_t num_b,
+                   K64V64* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsKV128Asc(const K64V64* const* runs, const size_t* num,
+                       size_t num_runs, K64V64* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeKV128Desc(const K64V64* HWY_RESTRICT a, size_t num_a,
+                    const K64V64* HWY_RESTRICT b, size_t num_b,
+                    K64V64* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsKV128Desc(const K64V64* const* runs, const size_t* num,
+                        size_t num_runs, K64V64* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+void MergeKV64Asc(const K32V32* HWY_RESTRICT a, size_t num_a,
+                  const K32V32* HWY_RESTRICT b, size_t num_b,
+                  K32V32* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortAscending());
+}
+
+void MergeRunsKV64Asc(const K32V32* const* runs, const size_t* num,
+                      size_t num_runs, K32V32* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortAscending());
+}
+
+void MergeKV64Desc(const K32V32* HWY_RESTRICT a, size_t num_a,
+                   const K32V32* HWY_RESTRICT b, size_t num_b,
+                   K32V32* HWY_RESTRICT out) {
+  return VQMergeStatic(a, num_a, b, num_b, out, SortDescending());
+}
+
+void MergeRunsKV64Desc(const K32V32* const* runs, const size_t* num,
+                       size_t num_runs, K32V32* HWY_RESTRICT out) {
+  return VQMergeRunsStatic(runs, num, num_runs, out, SortDescending());
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(MergeU16Asc);
+HWY_EXPORT(MergeRunsU16Asc);
+HWY_EXPORT(MergeU16Desc);
+HWY_EXPORT(MergeRunsU16Desc);
+HWY_EXPORT(MergeU32Asc);
+HWY_EXPORT(MergeRunsU32Asc);
+HWY_EXPORT(MergeU32Desc);
+HWY_EXPORT(MergeRunsU32Desc);
+HWY_EXPORT(MergeU64Asc);
+HWY_EXPORT(MergeRunsU64Asc);
+HWY_EXPORT(MergeU64Desc);
+HWY_EXPORT(MergeRunsU64Desc);
+HWY_EXPORT(MergeI16Asc);
+HWY_EXPORT(MergeRunsI16Asc);
+HWY_EXPORT(MergeI16Desc);
+HWY_EXPORT(MergeRunsI16Desc);
+HWY_EXPORT(MergeI32Asc);
+HWY_EXPORT(MergeRunsI32Asc);
+HWY_EXPORT(MergeI32Desc);
+HWY_EXPORT(MergeRunsI32Desc);
+HWY_EXPORT(MergeI64Asc);
+HWY_EXPORT(MergeRunsI64Asc);
+HWY_EXPORT(MergeI64Desc);
+HWY_EXPORT(MergeRunsI64Desc);
+HWY_EXPORT(MergeF16Asc);
+HWY_EXPORT(MergeRunsF16Asc);
+HWY_EXPORT(MergeF16Desc);
+HWY_EXPORT(MergeRunsF16Desc);
+HWY_EXPORT(MergeF32Asc);
+HWY_EXPORT(MergeRunsF32Asc);
+HWY_EXPORT(MergeF32Desc);
+HWY_EXPORT(MergeRunsF32Desc);
+HWY_EXPORT(MergeF64Asc);
+HWY_EXPORT(MergeRunsF64Asc);
+HWY_EXPORT(MergeF64Desc);
+HWY_EXPORT(MergeRunsF64Desc);
+HWY_EXPORT(Merge128Asc);
+HWY_EXPORT(MergeRuns128Asc);
+HWY_EXPORT(Merge128Desc);
+HWY_EXPORT(MergeRuns128Desc);
+HWY_EXPORT(MergeKV128Asc);
+HWY_EXPORT(MergeRunsKV128Asc);
+HWY_EXPORT(MergeKV128Desc);
+HWY_EXPORT(MergeRunsKV128Desc);
+HWY_EXPORT(MergeKV64Asc);
+HWY_EXPORT(MergeRunsKV64Asc);
+HWY_EXPORT(MergeKV64Desc);
+HWY_EXPORT(MergeRunsKV64Desc);
+}  // namespace
+
+void VQMerge(const uint16_t* HWY_RESTRICT a, size_t num_a,
+             const uint16_t* HWY_RESTRICT b, size_t num_b,
+             uint16_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeU16Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint16_t* const* runs, const size_t* num,
+                 size_t num_runs, uint16_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU16Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint16_t* HWY_RESTRICT a, size_t num_a,
+             const uint16_t* HWY_RESTRICT b, size_t num_b,
+             uint16_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeU16Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint16_t* const* runs, const size_t* num,
+                 size_t num_runs, uint16_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU16Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint32_t* HWY_RESTRICT a, size_t num_a,
+             const uint32_t* HWY_RESTRICT b, size_t num_b,
+             uint32_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeU32Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint32_t* const* runs, const size_t* num,
+                 size_t num_runs, uint32_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU32Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint32_t* HWY_RESTRICT a, size_t num_a,
+             const uint32_t* HWY_RESTRICT b, size_t num_b,
+             uint32_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeU32Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint32_t* const* runs, const size_t* num,
+                 size_t num_runs, uint32_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU32Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint64_t* HWY_RESTRICT a, size_t num_a,
+             const uint64_t* HWY_RESTRICT b, size_t num_b,
+             uint64_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeU64Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint64_t* const* runs, const size_t* num,
+                 size_t num_runs, uint64_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU64Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint64_t* HWY_RESTRICT a, size_t num_a,
+             const uint64_t* HWY_RESTRICT b, size_t num_b,
+             uint64_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeU64Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint64_t* const* runs, const size_t* num,
+                 size_t num_runs, uint64_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsU64Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const int16_t* HWY_RESTRICT a, size_t num_a,
+             const int16_t* HWY_RESTRICT b, size_t num_b,
+             int16_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeI16Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const int16_t* const* runs, const size_t* num,
+                 size_t num_runs, int16_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI16Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const int16_t* HWY_RESTRICT a, size_t num_a,
+             const int16_t* HWY_RESTRICT b, size_t num_b,
+             int16_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeI16Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const int16_t* const* runs, const size_t* num,
+                 size_t num_runs, int16_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI16Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const int32_t* HWY_RESTRICT a, size_t num_a,
+             const int32_t* HWY_RESTRICT b, size_t num_b,
+             int32_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeI32Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const int32_t* const* runs, const size_t* num,
+                 size_t num_runs, int32_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI32Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const int32_t* HWY_RESTRICT a, size_t num_a,
+             const int32_t* HWY_RESTRICT b, size_t num_b,
+             int32_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeI32Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const int32_t* const* runs, const size_t* num,
+                 size_t num_runs, int32_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI32Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const int64_t* HWY_RESTRICT a, size_t num_a,
+             const int64_t* HWY_RESTRICT b, size_t num_b,
+             int64_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeI64Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const int64_t* const* runs, const size_t* num,
+                 size_t num_runs, int64_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI64Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const int64_t* HWY_RESTRICT a, size_t num_a,
+             const int64_t* HWY_RESTRICT b, size_t num_b,
+             int64_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeI64Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const int64_t* const* runs, const size_t* num,
+                 size_t num_runs, int64_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsI64Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const float16_t* HWY_RESTRICT a, size_t num_a,
+             const float16_t* HWY_RESTRICT b, size_t num_b,
+             float16_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeF16Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const float16_t* const* runs, const size_t* num,
+                 size_t num_runs, float16_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF16Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const float16_t* HWY_RESTRICT a, size_t num_a,
+             const float16_t* HWY_RESTRICT b, size_t num_b,
+             float16_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeF16Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const float16_t* const* runs, const size_t* num,
+                 size_t num_runs, float16_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF16Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const float* HWY_RESTRICT a, size_t num_a,
+             const float* HWY_RESTRICT b, size_t num_b,
+             float* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeF32Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const float* const* runs, const size_t* num, size_t num_runs,
+                 float* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF32Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const float* HWY_RESTRICT a, size_t num_a,
+             const float* HWY_RESTRICT b, size_t num_b,
+             float* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeF32Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const float* const* runs, const size_t* num, size_t num_runs,
+                 float* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF32Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const double* HWY_RESTRICT a, size_t num_a,
+             const double* HWY_RESTRICT b, size_t num_b,
+             double* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeF64Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const double* const* runs, const size_t* num, size_t num_runs,
+                 double* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF64Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const double* HWY_RESTRICT a, size_t num_a,
+             const double* HWY_RESTRICT b, size_t num_b,
+             double* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeF64Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const double* const* runs, const size_t* num, size_t num_runs,
+                 double* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsF64Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint128_t* HWY_RESTRICT a, size_t num_a,
+             const uint128_t* HWY_RESTRICT b, size_t num_b,
+             uint128_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(Merge128Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint128_t* const* runs, const size_t* num,
+                 size_t num_runs, uint128_t* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRuns128Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const uint128_t* HWY_RESTRICT a, size_t num_a,
+             const uint128_t* HWY_RESTRICT b, size_t num_b,
+             uint128_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(Merge128Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const uint128_t* const* runs, const size_t* num,
+                 size_t num_runs, uint128_t* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRuns128Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const K64V64* HWY_RESTRICT a, size_t num_a,
+             const K64V64* HWY_RESTRICT b, size_t num_b,
+             K64V64* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeKV128Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const K64V64* const* runs, const size_t* num, size_t num_runs,
+                 K64V64* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV128Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const K64V64* HWY_RESTRICT a, size_t num_a,
+             const K64V64* HWY_RESTRICT b, size_t num_b,
+             K64V64* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeKV128Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const K64V64* const* runs, const size_t* num, size_t num_runs,
+                 K64V64* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV128Desc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const K32V32* HWY_RESTRICT a, size_t num_a,
+             const K32V32* HWY_RESTRICT b, size_t num_b,
+             K32V32* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeKV64Asc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const K32V32* const* runs, const size_t* num, size_t num_runs,
+                 K32V32* HWY_RESTRICT out, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV64Asc)(runs, num, num_runs, out);
+}
+
+void VQMerge(const K32V32* HWY_RESTRICT a, size_t num_a,
+             const K32V32* HWY_RESTRICT b, size_t num_b,
+             K32V32* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeKV64Desc)(a, num_a, b, num_b, out);
+}
+
+void VQMergeRuns(const K32V32* const* runs, const size_t* num, size_t num_runs,
+                 K32V32* HWY_RESTRICT out, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(MergeRunsKV64Desc)(runs, num, num_runs, out);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
@@ -0,0 +1,394 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sorting of many independent segments in one call. Segments that fit in the
+// base case go directly to the sorting networks, skipping the dispatch,
+// special-case checks and generator setup of a VQSort call per segment. Larger
+// segments, whose sorting cost dwarfs that overhead, are passed to VQSort.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"  // VQSortSegments
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_segments.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/contrib/sort/vqsort-inl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+#if VQSORT_ENABLED
+
+template <class D, class Traits, typename T, class Order>
+void SortEachSegment(D d, Traits st, T* HWY_RESTRICT keys,
+                     const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                     Order order) {
+#if HWY_MAX_BYTES > 64
+  // sorting_networks-inl and traits assume no more than 512 bit vectors.
+  if (HWY_UNLIKELY(Lanes(d) > 64 / sizeof(T))) {
+    return SortEachSegment(CappedTag<T, 64 / sizeof(T)>(), st, keys, offsets,
+                           num_segments, order);
+  }
+#endif  // HWY_MAX_BYTES > 64
+
+  const size_t base_case_num = Constants::BaseCaseNumLanes<1>(Lanes(d));
+  HWY_ALIGN T buf[SortConstants::BufBytes<T, 1>(HWY_MAX_BYTES) / sizeof(T)];
+  for (size_t i = 0; i < num_segments; ++i) {
+    HWY_DASSERT(offsets[i] <= offsets[i + 1]);
+    T* HWY_RESTRICT segment = keys + offsets[i];
+    const size_t num = offsets[i + 1] - offsets[i];
+    if (HWY_LIKELY(num <= base_case_num)) {
+      // Same as Sort, minus the checks that only matter for larger inputs.
+      const size_t num_nan = CountAndReplaceNaN(d, st, segment, num);
+      BaseCase(d, st, segment, num, buf);
+      if (num_nan != 0) {
+        Fill(d, GetLane(NaN(d)), num_nan, segment + num - num_nan);
+      }
+    } else {
+      VQSort(segment, num, order);
+    }
+  }
+}
+
+#endif  // VQSORT_ENABLED
+
+template <typename T, class Order>
+void SortSegments(T* HWY_RESTRICT keys, const size_t* HWY_RESTRICT offsets,
+                  size_t num_segments, Order order) {
+#if VQSORT_ENABLED
+  using Adapter = KeyAdapter<T>;
+  using KeyOrder = If<Order().IsAscending(), typename Adapter::Ascending,
+                      typename Adapter::Descending>;
+  const SharedTraits<typename Adapter::template Traits<KeyOrder>> st;
+  SortEachSegment(SortTag<T>(), st, keys, offsets, num_segments, order);
+#else
+  for (size_t i = 0; i < num_segments; ++i) {
+    VQSort(keys + offsets[i], offsets[i + 1] - offsets[i], order);
+  }
+#endif  // VQSORT_ENABLED
+}
+
+}  // namespace detail
+
+void SortSegmentsU32Asc(uint32_t* HWY_RESTRICT keys,
+                        const size_t* HWY_RESTRICT offsets,
+                        size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortAscending());
+}
+
+void SortSegmentsU32Desc(uint32_t* HWY_RESTRICT keys,
+                         const size_t* HWY_RESTRICT offsets,
+                         size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortDescending());
+}
+
+void SortSegmentsI32Asc(int32_t* HWY_RESTRICT keys,
+                        const size_t* HWY_RESTRICT offsets,
+                        size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortAscending());
+}
+
+void SortSegmentsI32Desc(int32_t* HWY_RESTRICT keys,
+                         const size_t* HWY_RESTRICT offsets,
+                         size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortDescending());
+}
+
+void SortSegmentsF32Asc(float* HWY_RESTRICT keys,
+                        const size_t* HWY_RESTRICT offsets,
+                        size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortAscending());
+}
+
+void SortSegmentsF32Desc(float* HWY_RESTRICT keys,
+                         const size_t* HWY_RESTRICT offsets,
+                         size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortDescending());
+}
+
+void SortSegmentsU64Asc(uint64_t* HWY_RESTRICT keys,
+                        const size_t* HWY_RESTRICT offsets,
+                        size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortAscending());
+}
+
+void SortSegmentsU64Desc(uint64_t* HWY_RESTRICT keys,
+                         const size_t* HWY_RESTRICT offsets,
+                         size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortDescending());
+}
+
+void SortSegmentsI64Asc(int64_t* HWY_RESTRICT keys,
+                        const size_t* HWY_RESTRICT offsets,
+                        size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortAscending());
+}
+
+void SortSegmentsI64Desc(int64_t* HWY_RESTRICT keys,
+                         const size_t* HWY_RESTRICT offsets,
+                         size_t num_segments) {
+  detail::SortSegments(keys, offsets, num_segments, SortDescending());
+}
+
+void SortSegmentsF64Asc(double* HWY_RESTRICT keys,
+                        const size_t* HWY_RESTRICT offsets,
+                        size_t num_segments) {
+#if HWY_HAVE_FLOAT64
+  detail::SortSegments(keys, offsets, num_segments, SortAscending());
+#else
+  for (size_t i = 0; i < num_segments; ++i) {
+    VQSort(keys + offsets[i], offsets[i + 1] - offsets[i], SortAscending());
+  }
+#endif
+}
+
+void SortSegmentsF64Desc(double* HWY_RESTRICT keys,
+                         const size_t* HWY_RESTRICT offsets,
+                         size_t num_segments) {
+#if HWY_HAVE_FLOAT64
+  detail::SortSegments(keys, offsets, num_segments, SortDescending());
+#else
+  for (size_t i = 0; i < num_segments; ++i) {
+    VQSort(keys + offsets[i], offsets[i + 1] - offsets[i], SortDescending());
+  }
+#endif
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(SortSegmentsU32Asc);
+HWY_EXPORT(SortSegmentsU32Desc);
+HWY_EXPORT(SortSegmentsI32Asc);
+HWY_EXPORT(SortSegmentsI32Desc);
+HWY_EXPORT(SortSegmentsF32Asc);
+HWY_EXPORT(SortSegmentsF32Desc);
+HWY_EXPORT(SortSegmentsU64Asc);
+HWY_EXPORT(SortSegmentsU64Desc);
+HWY_EXPORT(SortSegmentsI64Asc);
+HWY_EXPORT(SortSegmentsI64Desc);
+HWY_EXPORT(SortSegmentsF64Asc);
+HWY_EXPORT(SortSegmentsF64Desc);
+
+template <typename T>
+using SortSegmentsFunc = void (*)(T* HWY_RESTRICT, const size_t* HWY_RESTRICT,
+                                  size_t);
+
+// Splits the segments into contiguous groups with similar numbers of keys,
+// several per worker so that work stealing can balance their sorting costs.
+template <typename T>
+void SortSegmentsParallel(SortSegmentsFunc<T> func, T* HWY_RESTRICT keys,
+                          const size_t* HWY_RESTRICT offsets,
+                          size_t num_segments, ThreadPool& pool) {
+  const size_t num_tasks = HWY_MIN(num_segments, 4 * pool.NumWorkers());
+  if (num_tasks <= 1) return func(keys, offsets, num_segments);
+
+  const size_t keys_per_task =
+      DivCeil(offsets[num_segments] - offsets[0], num_tasks);
+  std::vector<size_t> first_segments = {0};
+  size_t next_begin = offsets[0] + keys_per_task;
+  for (size_t i = 1; i < num_segments; ++i) {
+    if (offsets[i] >= next_begin) {
+      first_segments.push_back(i);
+      next_begin = offsets[i] + keys_per_task;
+    }
+  }
+  first_segments.push_back(num_segments);
+
+  pool.Run(0, first_segments.size() - 1,
+           [&](uint64_t task, size_t /*thread*/) {
+             const size_t first = first_segments[task];
+             func(keys, offsets + first, first_segments[task + 1] - first);
+           });
+}
+
+}  // namespace
+
+void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU32Asc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsU32Asc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU32Desc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(uint32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsU32Desc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI32Asc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsI32Asc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI32Desc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(int32_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsI32Desc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(float* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF32Asc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(float* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsF32Asc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(float* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF32Desc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(float* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsF32Desc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU64Asc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsU64Asc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsU64Desc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(uint64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsU64Desc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI64Asc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsI64Asc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsI64Desc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(int64_t* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsI64Desc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(double* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF64Asc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(double* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortAscending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsF64Asc), keys, offsets,
+                       num_segments, pool);
+}
+
+void VQSortSegments(double* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortSegmentsF64Desc)(keys, offsets, num_segments);
+}
+
+void VQSortSegments(double* HWY_RESTRICT keys,
+                    const size_t* HWY_RESTRICT offsets, size_t num_segments,
+                    SortDescending, ThreadPool& pool) {
+  SortSegmentsParallel(HWY_DYNAMIC_POINTER(SortSegmentsF64Desc), keys, offsets,
+                       num_segments, pool);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
@@ -0,0 +1,191 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Sorting of byte strings, multikey quicksort style: strings are sorted by the
+// big-endian integer formed by their 8 bytes at the current depth, using the
+// K64V64 VQSort with the string index as the value. Each group of strings with
+// equal prefixes is then sorted at depth + 8. Strings that end within the
+// prefix are complete and precede the longer strings of their group.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>  // memcmp
+
+#include <algorithm>  // std::sort, std::partition, std::reverse
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"  // VQSortStrings
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_string.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Smaller groups are sorted by comparing the strings directly, which is
+// cheaper than extracting their prefixes and calling VQSort.
+constexpr size_t kMinStringsForVQSort = 32;
+
+// Returns the 8 bytes of `s` starting at `depth` as a big-endian integer, so
+// that integer order matches lexicographic order. Bytes past the end are zero.
+HWY_INLINE uint64_t StringPrefix(const SortString& s, size_t depth) {
+  uint8_t bytes[8] = {0};
+  if (s.size >= depth + 8) {
+    CopyBytes<8>(s.data + depth, bytes);
+  } else if (s.size > depth) {
+    CopyBytes(s.data + depth, bytes, s.size - depth);
+  }
+  uint64_t prefix = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    prefix = (prefix << 8) | bytes[i];
+  }
+  return prefix;
+}
+
+// Lexicographic comparison of bytes at and after `depth`; the caller ensures
+// the preceding bytes are equal.
+HWY_INLINE bool StringLess(const SortString& a, const SortString& b,
+                           size_t depth) {
+  const size_t min_size = HWY_MIN(a.size, b.size);
+  if (min_size > depth) {
+    const int cmp = memcmp(a.data + depth, b.data + depth, min_size - depth);
+    if (cmp != 0) return cmp < 0;
+  }
+  return a.size < b.size;
+}
+
+// Returns the index of the first key after `begin` whose key differs from that
+// of keys[begin], or `num` if there is none. Groups are usually short, but
+// strings with long common prefixes result in large groups.
+template <class D>
+HWY_INLINE size_t EqualPrefixEnd(D d, const K64V64* HWY_RESTRICT keys,
+                                 size_t begin, size_t num) {
+  const size_t N = Lanes(d);
+  const uint64_t* HWY_RESTRICT lanes = reinterpret_cast<const uint64_t*>(keys);
+  const uint64_t first = keys[begin].key;
+  const Vec<D> vfirst = Set(d, first);
+  size_t i = begin + 1;
+  for (; i + N <= num; i += N) {
+    Vec<D> values, prefixes;
+    LoadInterleaved2(d, lanes + 2 * i, values, prefixes);
+    const intptr_t pos = FindFirstTrue(d, Ne(prefixes, vfirst));
+    if (pos >= 0) return i + static_cast<size_t>(pos);
+  }
+  for (; i < num; ++i) {
+    if (keys[i].key != first) return i;
+  }
+  return num;
+}
+
+struct StringRange {
+  size_t begin;
+  size_t end;
+  size_t depth;  // Bytes before this are equal for all strings in the range.
+};
+
+}  // namespace detail
+
+// Ascending order; the caller reverses the result for descending.
+void SortStrings(SortString* HWY_RESTRICT strings, size_t n) {
+  if (n <= 1) return;
+  const ScalableTag<uint64_t> d64;
+
+  AlignedFreeUniquePtr<K64V64[]> keys = AllocateAligned<K64V64>(n);
+  AlignedFreeUniquePtr<SortString[]> permuted = AllocateAligned<SortString>(n);
+  HWY_ASSERT(keys && permuted);
+
+  // Explicit stack because recursion depth is proportional to the length of
+  // the common prefixes.
+  std::vector<detail::StringRange> ranges = {{0, n, 0}};
+  while (!ranges.empty()) {
+    const detail::StringRange range = ranges.back();
+    ranges.pop_back();
+    const size_t depth = range.depth;
+    SortString* group = strings + range.begin;
+    const size_t num = range.end - range.begin;
+
+    if (num < detail::kMinStringsForVQSort) {
+      std::sort(group, group + num,
+                [depth](const SortString& a, const SortString& b) {
+                  return detail::StringLess(a, b, depth);
+                });
+      continue;
+    }
+
+    for (size_t i = 0; i < num; ++i) {
+      keys[i].key = detail::StringPrefix(group[i], depth);
+      keys[i].value = i;
+    }
+    VQSort(keys.get(), num, SortAscending());
+    for (size_t i = 0; i < num; ++i) {
+      permuted[i] = group[keys[i].value];
+    }
+    CopyBytes(permuted.get(), group, num * sizeof(SortString));
+
+    for (size_t begin = 0; begin < num;) {
+      const size_t end = detail::EqualPrefixEnd(d64, keys.get(), begin, num);
+      if (end - begin >= 2) {
+        // Complete strings are prefixes of the others. Their padded prefixes
+        // are equal, hence equal sizes imply equal strings.
+        SortString* complete_end = std::partition(
+            group + begin, group + end,
+            [depth](const SortString& s) { return s.size <= depth + 8; });
+        std::sort(group + begin, complete_end,
+                  [](const SortString& a, const SortString& b) {
+                    return a.size < b.size;
+                  });
+        const size_t first_long = static_cast<size_t>(complete_end - strings);
+        if (range.begin + end - first_long >= 2) {
+          ranges.push_back({first_long, range.begin + end, depth + 8});
+        }
+      }
+      begin = end;
+    }
+  }
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(SortStrings);
+}  // namespace
+
+void VQSortStrings(SortString* HWY_RESTRICT strings, size_t n, SortAscending) {
+  HWY_DYNAMIC_DISPATCH(SortStrings)(strings, n);
+}
+
+void VQSortStrings(SortString* HWY_RESTRICT strings, size_t n, SortDescending) {
+  HWY_DYNAMIC_DISPATCH(SortStrings)(strings, n);
+  std::reverse(strings, strings + n);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
@@ -0,0 +1,517 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Top-k selection from a read-only array. Keys are converted to ranks as in
+// argsort and filtered against the rank of the current k-th key. Survivors are
+// compressed into a small buffer of (index, rank) pairs, which is reduced to
+// the best k with VQSelect whenever it fills up.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"  // VQTopK
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_topk.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/contrib/sort/rank-inl.h"
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+// Writes to out[0, k) the k keys with the lowest rank, in ascending order of
+// rank and then index, and their indices to indices[0, k) unless null. Each
+// 128-bit key of the buffer holds an index (lower half) and a rank widened to
+// 64 bits (upper half), as in ArgSort128.
+template <class Order, typename T, typename TI>
+void TopK(const T* HWY_RESTRICT keys, const size_t num, size_t k,
+          T* HWY_RESTRICT out, TI* HWY_RESTRICT indices) {
+  HWY_DASSERT(num == 0 || static_cast<uint64_t>(num - 1) <= LimitsMax<TI>());
+  k = HWY_MIN(k, num);
+  if (k == 0) return;
+
+  const ScalableTag<uint64_t> d64;
+  using V64 = Vec<decltype(d64)>;
+  using M64 = Mask<decltype(d64)>;
+  const Rebind<MakeUnsigned<T>, decltype(d64)> du;
+  const size_t N = Lanes(d64);
+
+  // Reducing the buffer to k keys costs O(capacity), which is amortized over
+  // the at least capacity - k keys that were appended since the last time.
+  const size_t capacity = HWY_MAX(2 * k, 16 * N);
+  // Padded because we append whole vectors.
+  AlignedFreeUniquePtr<uint64_t[]> buf =
+      AllocateAligned<uint64_t>(2 * (capacity + N));
+  HWY_ASSERT(buf);
+  uint128_t* HWY_RESTRICT packed = reinterpret_cast<uint128_t*>(buf.get());
+  size_t size = 0;
+
+  // Until the buffer first fills up, all keys are appended. Afterwards, only
+  // keys whose rank is less than that of the current k-th key. Equal ranks are
+  // rejected because their index is higher than those in the buffer.
+  bool have_bound = false;
+  V64 bound = Zero(d64);
+  const auto append = [&](V64 rank, V64 idx, M64 keep) HWY_ATTR {
+    if (have_bound) keep = And(keep, Lt(rank, bound));
+    if (HWY_LIKELY(AllFalse(d64, keep))) return;
+    StoreInterleaved2(Compress(idx, keep), Compress(rank, keep), d64,
+                      buf.get() + 2 * size);
+    size += CountTrue(d64, keep);
+    if (size >= capacity) {
+      VQSelect(packed, size, k - 1, SortAscending());
+      size = k;
+      bound = Set(d64, packed[k - 1].hi);
+      have_bound = true;
+    }
+  };
+
+  V64 idx = Iota(d64, 0);
+  const V64 vN = Set(d64, static_cast<uint64_t>(N));
+  const M64 all = FirstN(d64, N);
+  size_t i = 0;
+  for (; i + N <= num; i += N) {
+    const V64 rank =
+        WidenRank(d64, KeyRank<Order, T>(du, LoadKeyBits(d64, keys + i, N)));
+    append(rank, idx, all);
+    idx = Add(idx, vN);
+  }
+  if (i != num) {
+    const size_t remaining = num - i;
+    const V64 rank = WidenRank(
+        d64, KeyRank<Order, T>(du, LoadKeyBits(d64, keys + i, remaining)));
+    append(rank, idx, FirstN(d64, remaining));
+  }
+
+  // PartialSort requires k < size.
+  if (size == k) {
+    VQSort(packed, size, SortAscending());
+  } else {
+    VQPartialSort(packed, size, k, SortAscending());
+  }
+  for (size_t j = 0; j < k; ++j) {
+    const size_t index = static_cast<size_t>(packed[j].lo);
+    out[j] = keys[index];
+    if (indices) indices[j] = static_cast<TI>(index);
+  }
+}
+
+}  // namespace detail
+
+void TopKU32U32Asc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, uint32_t* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKU32U32Desc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, uint32_t* HWY_RESTRICT out,
+                    uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKU32U64Asc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, uint32_t* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKU32U64Desc(const uint32_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, uint32_t* HWY_RESTRICT out,
+                    uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKI32U32Asc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, int32_t* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKI32U32Desc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, int32_t* HWY_RESTRICT out,
+                    uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKI32U64Asc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, int32_t* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKI32U64Desc(const int32_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, int32_t* HWY_RESTRICT out,
+                    uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKF32U32Asc(const float* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, float* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKF32U32Desc(const float* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, float* HWY_RESTRICT out,
+                    uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKF32U64Asc(const float* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, float* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKF32U64Desc(const float* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, float* HWY_RESTRICT out,
+                    uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKU64U32Asc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, uint64_t* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKU64U32Desc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, uint64_t* HWY_RESTRICT out,
+                    uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKU64U64Asc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, uint64_t* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKU64U64Desc(const uint64_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, uint64_t* HWY_RESTRICT out,
+                    uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKI64U32Asc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, int64_t* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKI64U32Desc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, int64_t* HWY_RESTRICT out,
+                    uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKI64U64Asc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, int64_t* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKI64U64Desc(const int64_t* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, int64_t* HWY_RESTRICT out,
+                    uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKF64U32Asc(const double* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, double* HWY_RESTRICT out,
+                   uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKF64U32Desc(const double* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, double* HWY_RESTRICT out,
+                    uint32_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+void TopKF64U64Asc(const double* HWY_RESTRICT keys, const size_t num,
+                   const size_t k, double* HWY_RESTRICT out,
+                   uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortAscending>(keys, num, k, out, indices);
+}
+
+void TopKF64U64Desc(const double* HWY_RESTRICT keys, const size_t num,
+                    const size_t k, double* HWY_RESTRICT out,
+                    uint64_t* HWY_RESTRICT indices) {
+  detail::TopK<SortDescending>(keys, num, k, out, indices);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(TopKU32U32Asc);
+HWY_EXPORT(TopKU32U32Desc);
+HWY_EXPORT(TopKU32U64Asc);
+HWY_EXPORT(TopKU32U64Desc);
+HWY_EXPORT(TopKI32U32Asc);
+HWY_EXPORT(TopKI32U32Desc);
+HWY_EXPORT(TopKI32U64Asc);
+HWY_EXPORT(TopKI32U64Desc);
+HWY_EXPORT(TopKF32U32Asc);
+HWY_EXPORT(TopKF32U32Desc);
+HWY_EXPORT(TopKF32U64Asc);
+HWY_EXPORT(TopKF32U64Desc);
+HWY_EXPORT(TopKU64U32Asc);
+HWY_EXPORT(TopKU64U32Desc);
+HWY_EXPORT(TopKU64U64Asc);
+HWY_EXPORT(TopKU64U64Desc);
+HWY_EXPORT(TopKI64U32Asc);
+HWY_EXPORT(TopKI64U32Desc);
+HWY_EXPORT(TopKI64U64Asc);
+HWY_EXPORT(TopKI64U64Desc);
+HWY_EXPORT(TopKF64U32Asc);
+HWY_EXPORT(TopKF64U32Desc);
+HWY_EXPORT(TopKF64U64Asc);
+HWY_EXPORT(TopKF64U64Desc);
+}  // namespace
+
+void VQTopK(const uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint32_t* HWY_RESTRICT out, SortAscending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKU32U64Asc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint32_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKU32U32Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint32_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKU32U64Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint32_t* HWY_RESTRICT out, SortDescending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKU32U64Desc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint32_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKU32U32Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint32_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKU32U64Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int32_t* HWY_RESTRICT out, SortAscending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKI32U64Asc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int32_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKI32U32Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int32_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKI32U64Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int32_t* HWY_RESTRICT out, SortDescending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKI32U64Desc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int32_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKI32U32Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int32_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKI32U64Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const float* HWY_RESTRICT keys, const size_t n, const size_t k,
+            float* HWY_RESTRICT out, SortAscending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKF32U64Asc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const float* HWY_RESTRICT keys, const size_t n, const size_t k,
+            float* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKF32U32Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const float* HWY_RESTRICT keys, const size_t n, const size_t k,
+            float* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKF32U64Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const float* HWY_RESTRICT keys, const size_t n, const size_t k,
+            float* HWY_RESTRICT out, SortDescending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKF32U64Desc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const float* HWY_RESTRICT keys, const size_t n, const size_t k,
+            float* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKF32U32Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const float* HWY_RESTRICT keys, const size_t n, const size_t k,
+            float* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKF32U64Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint64_t* HWY_RESTRICT out, SortAscending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKU64U64Asc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint64_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKU64U32Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint64_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKU64U64Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint64_t* HWY_RESTRICT out, SortDescending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKU64U64Desc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint64_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKU64U32Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            uint64_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKU64U64Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int64_t* HWY_RESTRICT out, SortAscending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKI64U64Asc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int64_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKI64U32Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int64_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKI64U64Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int64_t* HWY_RESTRICT out, SortDescending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKI64U64Desc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int64_t* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKI64U32Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const int64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
+            int64_t* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKI64U64Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const double* HWY_RESTRICT keys, const size_t n, const size_t k,
+            double* HWY_RESTRICT out, SortAscending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKF64U64Asc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const double* HWY_RESTRICT keys, const size_t n, const size_t k,
+            double* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKF64U32Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const double* HWY_RESTRICT keys, const size_t n, const size_t k,
+            double* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortAscending) {
+  HWY_DYNAMIC_DISPATCH(TopKF64U64Asc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const double* HWY_RESTRICT keys, const size_t n, const size_t k,
+            double* HWY_RESTRICT out, SortDescending) {
+  uint64_t* HWY_RESTRICT no_indices = nullptr;
+  HWY_DYNAMIC_DISPATCH(TopKF64U64Desc)(keys, n, k, out, no_indices);
+}
+
+void VQTopK(const double* HWY_RESTRICT keys, const size_t n, const size_t k,
+            double* HWY_RESTRICT out, uint32_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKF64U32Desc)(keys, n, k, out, indices);
+}
+
+void VQTopK(const double* HWY_RESTRICT keys, const size_t n, const size_t k,
+            double* HWY_RESTRICT out, uint64_t* HWY_RESTRICT indices,
+            SortDescending) {
+  HWY_DYNAMIC_DISPATCH(TopKF64U64Desc)(keys, n, k, out, indices);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
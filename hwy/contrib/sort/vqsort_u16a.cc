@@ -30,6 +30,11 @@ void SortU16Asc(uint16_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortU16Asc(uint16_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortU16Asc(uint16_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU16Asc);
+HWY_EXPORT(ParallelSortU16Asc);
 HWY_EXPORT(PartialSortU16Asc);
 HWY_EXPORT(SelectU16Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint16_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortU16Asc)(keys, n);
 }
 
+void VQSort(uint16_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU16Asc)(keys, n, pool);
+}
+
 void VQPartialSort(uint16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortU16Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectU16Asc)(keys, n, k);
 }
 
+VQSortFunc<uint16_t> GetVQSortFunc(uint16_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortU16Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortU16Desc(uint16_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortU16Desc(uint16_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortU16Desc(uint16_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU16Desc);
+HWY_EXPORT(ParallelSortU16Desc);
 HWY_EXPORT(PartialSortU16Desc);
 HWY_EXPORT(SelectU16Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint16_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortU16Desc)(keys, n);
 }
 
+void VQSort(uint16_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU16Desc)(keys, n, pool);
+}
+
 void VQPartialSort(uint16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortU16Desc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint16_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectU16Desc)(keys, n, k);
 }
 
+VQSortFunc<uint16_t> GetVQSortFunc(uint16_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortU16Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
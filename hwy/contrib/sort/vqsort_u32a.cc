@@ -30,6 +30,11 @@ void SortU32Asc(uint32_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortU32Asc(uint32_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortU32Asc(uint32_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU32Asc);
+HWY_EXPORT(ParallelSortU32Asc);
 HWY_EXPORT(PartialSortU32Asc);
 HWY_EXPORT(SelectU32Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint32_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortU32Asc)(keys, n);
 }
 
+void VQSort(uint32_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU32Asc)(keys, n, pool);
+}
+
 void VQPartialSort(uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortU32Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectU32Asc)(keys, n, k);
 }
 
+VQSortFunc<uint32_t> GetVQSortFunc(uint32_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortU32Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortU32Desc(uint32_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortU32Desc(uint32_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortU32Desc(uint32_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU32Desc);
+HWY_EXPORT(ParallelSortU32Desc);
 HWY_EXPORT(PartialSortU32Desc);
 HWY_EXPORT(SelectU32Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint32_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortU32Desc)(keys, n);
 }
 
+void VQSort(uint32_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU32Desc)(keys, n, pool);
+}
+
 void VQPartialSort(uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortU32Desc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint32_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectU32Desc)(keys, n, k);
 }
 
+VQSortFunc<uint32_t> GetVQSortFunc(uint32_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortU32Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
@@ -30,6 +30,11 @@ void SortU64Asc(uint64_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortAscending());
 }
 
+void ParallelSortU64Asc(uint64_t* HWY_RESTRICT keys, const size_t num,
+                        ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortAscending(), pool);
+}
+
 void PartialSortU64Asc(uint64_t* HWY_RESTRICT keys, const size_t num,
                        const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortAscending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU64Asc);
+HWY_EXPORT(ParallelSortU64Asc);
 HWY_EXPORT(PartialSortU64Asc);
 HWY_EXPORT(SelectU64Asc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint64_t* HWY_RESTRICT keys, const size_t n, SortAscending) {
   HWY_DYNAMIC_DISPATCH(SortU64Asc)(keys, n);
 }
 
+void VQSort(uint64_t* HWY_RESTRICT keys, const size_t n, SortAscending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU64Asc)(keys, n, pool);
+}
+
 void VQPartialSort(uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortAscending) {
   HWY_DYNAMIC_DISPATCH(PartialSortU64Asc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectU64Asc)(keys, n, k);
 }
 
+VQSortFunc<uint64_t> GetVQSortFunc(uint64_t*, SortAscending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortU64Asc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
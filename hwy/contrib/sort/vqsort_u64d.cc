@@ -30,6 +30,11 @@ void SortU64Desc(uint64_t* HWY_RESTRICT keys, const size_t num) {
   return VQSortStatic(keys, num, SortDescending());
 }
 
+void ParallelSortU64Desc(uint64_t* HWY_RESTRICT keys, const size_t num,
+                         ThreadPool& pool) {
+  return VQSortStatic(keys, num, SortDescending(), pool);
+}
+
 void PartialSortU64Desc(uint64_t* HWY_RESTRICT keys, const size_t num,
                         const size_t k) {
   return VQPartialSortStatic(keys, num, k, SortDescending());
@@ -49,6 +54,7 @@ HWY_AFTER_NAMESPACE();
 namespace hwy {
 namespace {
 HWY_EXPORT(SortU64Desc);
+HWY_EXPORT(ParallelSortU64Desc);
 HWY_EXPORT(PartialSortU64Desc);
 HWY_EXPORT(SelectU64Desc);
 }  // namespace
@@ -57,6 +63,11 @@ void VQSort(uint64_t* HWY_RESTRICT keys, const size_t n, SortDescending) {
   HWY_DYNAMIC_DISPATCH(SortU64Desc)(keys, n);
 }
 
+void VQSort(uint64_t* HWY_RESTRICT keys, const size_t n, SortDescending,
+            ThreadPool& pool) {
+  HWY_DYNAMIC_DISPATCH(ParallelSortU64Desc)(keys, n, pool);
+}
+
 void VQPartialSort(uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
                    SortDescending) {
   HWY_DYNAMIC_DISPATCH(PartialSortU64Desc)(keys, n, k);
@@ -67,5 +78,10 @@ void VQSelect(uint64_t* HWY_RESTRICT keys, const size_t n, const size_t k,
   HWY_DYNAMIC_DISPATCH(SelectU64Desc)(keys, n, k);
 }
 
+VQSortFunc<uint64_t> GetVQSortFunc(uint64_t*, SortDescending) {
+  detail::InitChosenTarget();
+  return HWY_DYNAMIC_POINTER(SortU64Desc);
+}
+
 }  // namespace hwy
 #endif  // HWY_ONCE
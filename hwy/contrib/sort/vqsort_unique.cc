@@ -0,0 +1,365 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Removal of consecutive duplicates, typically after sorting. Each key is
+// compared with its predecessor, obtained via Slide1Up plus the last key of the
+// previous vector, and the first key of each run is compacted via
+// CompressStore. Keys are loaded as unsigned integers, so float equality is
+// also computed with integer operations.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hwy/base.h"
+#include "hwy/contrib/sort/vqsort.h"  // VQUnique
+
+#undef HWY_TARGET_INCLUDE
+// clang-format off
+// (avoid line break, which would prevent Copybara rules from matching)
+#define HWY_TARGET_INCLUDE "hwy/contrib/sort/vqsort_unique.cc"  //NOLINT
+// clang-format on
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// After foreach_target
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace hwy {
+namespace HWY_NAMESPACE {
+namespace detail {
+
+template <typename T, class D, class V = Vec<D>>
+HWY_INLINE Mask<D> SameKeys(D /*d*/, V a, V b, hwy::NonFloatTag) {
+  return Eq(a, b);
+}
+
+// `a` and `b` hold the bits of floating-point keys, which are the same if they
+// compare equal (including -0.0 and +0.0), or are both NaN.
+template <typename T, class D, class V = Vec<D>>
+HWY_INLINE Mask<D> SameKeys(D d, V a, V b, hwy::FloatTag) {
+  const V sign = Set(d, SignMask<T>());
+  const V exp = Set(d, ExponentMask<T>());
+  const V abs_a = AndNot(sign, a);
+  const V abs_b = AndNot(sign, b);
+  const Mask<D> both_zero = Eq(Or(abs_a, abs_b), Zero(d));
+  const Mask<D> both_nan = And(Gt(abs_a, exp), Gt(abs_b, exp));
+  return Or(Or(Eq(a, b), both_zero), both_nan);
+}
+
+// Returns a mask of the lanes whose key differs from that in the preceding
+// lane. `last` is the key preceding the first lane.
+template <typename T, class D, class V = Vec<D>>
+HWY_INLINE Mask<D> RunStarts(D d, V v, TFromD<D> last) {
+  const V prev = InsertLane(Slide1Up(d, v), 0, last);
+  return Not(SameKeys<T>(d, v, prev, hwy::IsFloatTag<T>()));
+}
+
+// For converting the mask of run starts to one for their 64-bit indices.
+template <class D64, class D, HWY_IF_T_SIZE_D(D, 8)>
+HWY_INLINE Mask<D64> IndexMask(D64 d64, D /*d*/, Mask<D> m) {
+  return RebindMask(d64, m);
+}
+template <class D64, class D, HWY_IF_T_SIZE_D(D, 4)>
+HWY_INLINE Mask<D64> IndexMask(D64 d64, D d, Mask<D> m) {
+  return PromoteMaskTo(d64, d, m);
+}
+
+template <typename T>
+size_t Unique(T* HWY_RESTRICT keys, size_t num) {
+  if (num == 0) return 0;
+  using TU = MakeUnsigned<T>;
+  const ScalableTag<TU> d;
+  using V = Vec<decltype(d)>;
+  const size_t N = Lanes(d);
+  TU* HWY_RESTRICT lanes = reinterpret_cast<TU*>(keys);
+
+  // The first key is always kept. Afterwards, count <= i, hence CompressStore
+  // only overwrites keys that were already loaded. However, the last key of
+  // the vector must be read before that.
+  size_t count = 1;
+  TU last = lanes[0];
+  size_t i = 1;
+  for (; i + N <= num; i += N) {
+    const V v = LoadU(d, lanes + i);
+    const Mask<decltype(d)> starts = RunStarts<T>(d, v, last);
+    last = lanes[i + N - 1];
+    count += CompressStore(v, starts, d, lanes + count);
+  }
+  const size_t remaining = num - i;
+  if (remaining != 0) {
+    const V v = LoadN(d, lanes + i, remaining);
+    const Mask<decltype(d)> starts =
+        And(RunStarts<T>(d, v, last), FirstN(d, remaining));
+    count += CompressBlendedStore(v, starts, d, lanes + count);
+  }
+  return count;
+}
+
+// As Unique, but also writes the index of the first key of each run to
+// `counts`, and then converts those to the length of each run. Keys occupy as
+// many lanes as the 64-bit indices, so both use the same mask.
+template <typename T>
+size_t UniqueCounts(const T* keys, size_t num, T* unique,
+                    uint64_t* HWY_RESTRICT counts) {
+  if (num == 0) return 0;
+  using TU = MakeUnsigned<T>;
+  const ScalableTag<uint64_t> d64;
+  const Rebind<TU, decltype(d64)> d;
+  using V = Vec<decltype(d)>;
+  using V64 = Vec<decltype(d64)>;
+  const size_t N = Lanes(d64);
+  const TU* lanes = reinterpret_cast<const TU*>(keys);
+  TU* out = reinterpret_cast<TU*>(unique);
+
+  // Same as in Unique, `out` may be the same as `keys`.
+  size_t count = 1;
+  TU last = lanes[0];
+  out[0] = last;
+  counts[0] = 0;
+  V64 idx = Iota(d64, 1);
+  const V64 vN = Set(d64, static_cast<uint64_t>(N));
+  size_t i = 1;
+  for (; i + N <= num; i += N) {
+    const V v = LoadU(d, lanes + i);
+    const Mask<decltype(d)> starts = RunStarts<T>(d, v, last);
+    last = lanes[i + N - 1];
+    CompressStore(v, starts, d, out + count);
+    count += CompressStore(idx, IndexMask(d64, d, starts), d64, counts + count);
+    idx = Add(idx, vN);
+  }
+  const size_t remaining = num - i;
+  if (remaining != 0) {
+    const V v = LoadN(d, lanes + i, remaining);
+    const Mask<decltype(d)> starts =
+        And(RunStarts<T>(d, v, last), FirstN(d, remaining));
+    CompressBlendedStore(v, starts, d, out + count);
+    count += CompressBlendedStore(idx, IndexMask(d64, d, starts), d64,
+                                  counts + count);
+  }
+
+  // Each run ends where the next begins. Loads are ahead of stores.
+  size_t j = 0;
+  for (; j + N < count; j += N) {
+    const V64 begin = LoadU(d64, counts + j);
+    const V64 end = LoadU(d64, counts + j + 1);
+    StoreU(Sub(end, begin), d64, counts + j);
+  }
+  for (; j < count; ++j) {
+    const uint64_t end = (j + 1 < count) ? counts[j + 1] : num;
+    counts[j] = end - counts[j];
+  }
+  return count;
+}
+
+}  // namespace detail
+
+size_t UniqueU32(uint32_t* HWY_RESTRICT keys, size_t num) {
+  return detail::Unique(keys, num);
+}
+
+size_t UniqueI32(int32_t* HWY_RESTRICT keys, size_t num) {
+  return detail::Unique(keys, num);
+}
+
+size_t UniqueF32(float* HWY_RESTRICT keys, size_t num) {
+  return detail::Unique(keys, num);
+}
+
+size_t UniqueU64(uint64_t* HWY_RESTRICT keys, size_t num) {
+  return detail::Unique(keys, num);
+}
+
+size_t UniqueI64(int64_t* HWY_RESTRICT keys, size_t num) {
+  return detail::Unique(keys, num);
+}
+
+size_t UniqueF64(double* HWY_RESTRICT keys, size_t num) {
+  return detail::Unique(keys, num);
+}
+
+size_t UniqueCountsU32(const uint32_t* keys, size_t num, uint32_t* unique,
+                       uint64_t* HWY_RESTRICT counts) {
+  return detail::UniqueCounts(keys, num, unique, counts);
+}
+
+size_t UniqueCountsI32(const int32_t* keys, size_t num, int32_t* unique,
+                       uint64_t* HWY_RESTRICT counts) {
+  return detail::UniqueCounts(keys, num, unique, counts);
+}
+
+size_t UniqueCountsF32(const float* keys, size_t num, float* unique,
+                       uint64_t* HWY_RESTRICT counts) {
+  return detail::UniqueCounts(keys, num, unique, counts);
+}
+
+size_t UniqueCountsU64(const uint64_t* keys, size_t num, uint64_t* unique,
+                       uint64_t* HWY_RESTRICT counts) {
+  return detail::UniqueCounts(keys, num, unique, counts);
+}
+
+size_t UniqueCountsI64(const int64_t* keys, size_t num, int64_t* unique,
+                       uint64_t* HWY_RESTRICT counts) {
+  return detail::UniqueCounts(keys, num, unique, counts);
+}
+
+size_t UniqueCountsF64(const double* keys, size_t num, double* unique,
+                       uint64_t* HWY_RESTRICT counts) {
+  return detail::UniqueCounts(keys, num, unique, counts);
+}
+
+// NOLINTNEXTLINE(google-readability-namespace-comments)
+}  // namespace HWY_NAMESPACE
+}  // namespace hwy
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace hwy {
+namespace {
+HWY_EXPORT(UniqueU32);
+HWY_EXPORT(UniqueI32);
+HWY_EXPORT(UniqueF32);
+HWY_EXPORT(UniqueU64);
+HWY_EXPORT(UniqueI64);
+HWY_EXPORT(UniqueF64);
+HWY_EXPORT(UniqueCountsU32);
+HWY_EXPORT(UniqueCountsI32);
+HWY_EXPORT(UniqueCountsF32);
+HWY_EXPORT(UniqueCountsU64);
+HWY_EXPORT(UniqueCountsI64);
+HWY_EXPORT(UniqueCountsF64);
+}  // namespace
+
+size_t VQUnique(uint32_t* HWY_RESTRICT keys, size_t n) {
+  return HWY_DYNAMIC_DISPATCH(UniqueU32)(keys, n);
+}
+
+size_t VQSortUnique(uint32_t* HWY_RESTRICT keys, size_t n,
+                    SortAscending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQSortUnique(uint32_t* HWY_RESTRICT keys, size_t n,
+                    SortDescending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQUniqueCounts(const uint32_t* keys, size_t n, uint32_t* unique,
+                      uint64_t* HWY_RESTRICT counts) {
+  return HWY_DYNAMIC_DISPATCH(UniqueCountsU32)(keys, n, unique, counts);
+}
+
+size_t VQUnique(int32_t* HWY_RESTRICT keys, size_t n) {
+  return HWY_DYNAMIC_DISPATCH(UniqueI32)(keys, n);
+}
+
+size_t VQSortUnique(int32_t* HWY_RESTRICT keys, size_t n, SortAscending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQSortUnique(int32_t* HWY_RESTRICT keys, size_t n,
+                    SortDescending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQUniqueCounts(const int32_t* keys, size_t n, int32_t* unique,
+                      uint64_t* HWY_RESTRICT counts) {
+  return HWY_DYNAMIC_DISPATCH(UniqueCountsI32)(keys, n, unique, counts);
+}
+
+size_t VQUnique(float* HWY_RESTRICT keys, size_t n) {
+  return HWY_DYNAMIC_DISPATCH(UniqueF32)(keys, n);
+}
+
+size_t VQSortUnique(float* HWY_RESTRICT keys, size_t n, SortAscending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQSortUnique(float* HWY_RESTRICT keys, size_t n, SortDescending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQUniqueCounts(const float* keys, size_t n, float* unique,
+                      uint64_t* HWY_RESTRICT counts) {
+  return HWY_DYNAMIC_DISPATCH(UniqueCountsF32)(keys, n, unique, counts);
+}
+
+size_t VQUnique(uint64_t* HWY_RESTRICT keys, size_t n) {
+  return HWY_DYNAMIC_DISPATCH(UniqueU64)(keys, n);
+}
+
+size_t VQSortUnique(uint64_t* HWY_RESTRICT keys, size_t n,
+                    SortAscending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQSortUnique(uint64_t* HWY_RESTRICT keys, size_t n,
+                    SortDescending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQUniqueCounts(const uint64_t* keys, size_t n, uint64_t* unique,
+                      uint64_t* HWY_RESTRICT counts) {
+  return HWY_DYNAMIC_DISPATCH(UniqueCountsU64)(keys, n, unique, counts);
+}
+
+size_t VQUnique(int64_t* HWY_RESTRICT keys, size_t n) {
+  return HWY_DYNAMIC_DISPATCH(UniqueI64)(keys, n);
+}
+
+size_t VQSortUnique(int64_t* HWY_RESTRICT keys, size_t n, SortAscending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQSortUnique(int64_t* HWY_RESTRICT keys, size_t n,
+                    SortDescending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQUniqueCounts(const int64_t* keys, size_t n, int64_t* unique,
+                      uint64_t* HWY_RESTRICT counts) {
+  return HWY_DYNAMIC_DISPATCH(UniqueCountsI64)(keys, n, unique, counts);
+}
+
+size_t VQUnique(double* HWY_RESTRICT keys, size_t n) {
+  return HWY_DYNAMIC_DISPATCH(UniqueF64)(keys, n);
+}
+
+size_t VQSortUnique(double* HWY_RESTRICT keys, size_t n, SortAscending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQSortUnique(double* HWY_RESTRICT keys, size_t n, SortDescending order) {
+  VQSort(keys, n, order);
+  return VQUnique(keys, n);
+}
+
+size_t VQUniqueCounts(const double* keys, size_t n, double* unique,
+                      uint64_t* HWY_RESTRICT counts) {
+  return HWY_DYNAMIC_DISPATCH(UniqueCountsF64)(keys, n, unique, counts);
+}
+
+}  // namespace hwy
+#endif  // HWY_ONCE
@@ -0,0 +1,229 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Fork-join latency, throughput and load balance of ThreadPool::Run for
+// various thread counts, task counts, wait modes and task costs. Prints one
+// CSV line per configuration to stdout.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>  // std::sort
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
+#include "hwy/contrib/thread_pool/topology.h"
+#include "hwy/robust_statistics.h"
+#include "hwy/timer.h"
+#include "hwy/tests/hwy_gtest.h"
+#include "hwy/tests/test_util-inl.h"  // AdjustedReps
+
+namespace hwy {
+namespace {
+using HWY_NAMESPACE::AdjustedReps;
+
+enum class Cost {
+  kUniform,     // all tasks equal
+  kIncreasing,  // later tasks are up to 8x as expensive
+  kRare,        // 1/64 of tasks are 32x as expensive
+};
+
+const char* CostName(Cost cost) {
+  switch (cost) {
+    case Cost::kUniform:
+      return "uniform";
+    case Cost::kIncreasing:
+      return "increasing";
+    case Cost::kRare:
+      return "rare";
+  }
+  return "?";
+}
+
+const char* WaitModeName(PoolWaitMode mode) {
+  switch (mode) {
+    case PoolWaitMode::kBlock:
+      return "block";
+    case PoolWaitMode::kSpin:
+      return "spin";
+    case PoolWaitMode::kAdaptive:
+      return "adaptive";
+  }
+  return "?";
+}
+
+// Deterministic, so that all configurations perform the same work.
+uint32_t CostUnits(Cost cost, uint64_t task, uint64_t num_tasks) {
+  switch (cost) {
+    case Cost::kUniform:
+      return 1;
+    case Cost::kIncreasing:
+      return static_cast<uint32_t>(1 + 8 * task / num_tasks);
+    case Cost::kRare:
+      // Scatter the expensive tasks.
+      return ((task * 0x9E3779B97F4A7C15ull) >> 58) == 0 ? 32 : 1;
+  }
+  return 1;
+}
+
+// About 20 ns per unit.
+HWY_NOINLINE void Work(uint32_t units) {
+  uint64_t x = units;
+  for (uint32_t i = 0; i < units * 16; ++i) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+  }
+  PreventElision(x);
+}
+
+// Per-worker counters, padded to avoid false sharing.
+struct alignas(HWY_ALIGNMENT) WorkerUnits {
+  uint64_t units;
+};
+
+// Returns the value at quantile `q` of `sorted`.
+uint64_t Percentile(const std::vector<uint64_t>& sorted, double q) {
+  HWY_ASSERT(!sorted.empty());
+  const size_t idx = static_cast<size_t>(q * static_cast<double>(sorted.size()));
+  return sorted[HWY_MIN(idx, sorted.size() - 1)];
+}
+
+void PrintHeader() {
+  printf(
+      "threads,tasks,wait,cost,runs,p50_ns,p99_ns,p999_ns,mad_ns,"
+      "tasks_per_sec,imbalance_median,imbalance_max,stolen_fraction\n");
+}
+
+void BenchConfig(ThreadPool& pool, PoolWaitMode mode, uint64_t num_tasks,
+                 Cost cost, size_t num_runs) {
+  const size_t num_workers = pool.NumWorkers();
+  pool.SetWaitMode(mode);
+
+  AlignedFreeUniquePtr<WorkerUnits[]> units =
+      AllocateAligned<WorkerUnits>(num_workers);
+  HWY_ASSERT(units);
+  const auto closure = [&](uint64_t task, size_t thread) {
+    const uint32_t task_units = CostUnits(cost, task, num_tasks);
+    Work(task_units);
+    units[thread].units += task_units;
+  };
+
+  // Warm up caches and the kAdaptive spin budget.
+  for (size_t rep = 0; rep < 10; ++rep) {
+    pool.Run(0, num_tasks, closure);
+  }
+  pool.ResetStats();
+
+  std::vector<uint64_t> latencies;
+  std::vector<uint64_t> imbalances;  // max/mean, in thousandths
+  latencies.reserve(num_runs);
+  imbalances.reserve(num_runs);
+  double total_seconds = 0.0;
+  for (size_t rep = 0; rep < num_runs; ++rep) {
+    for (size_t thread = 0; thread < num_workers; ++thread) {
+      units[thread].units = 0;
+    }
+
+    const double t0 = platform::Now();
+    pool.Run(0, num_tasks, closure);
+    const double elapsed = platform::Now() - t0;
+    total_seconds += elapsed;
+    latencies.push_back(static_cast<uint64_t>(elapsed * 1E9));
+
+    uint64_t sum = 0;
+    uint64_t max = 0;
+    for (size_t thread = 0; thread < num_workers; ++thread) {
+      sum += units[thread].units;
+      max = HWY_MAX(max, units[thread].units);
+    }
+    HWY_ASSERT(sum != 0);
+    imbalances.push_back(max * num_workers * 1000 / sum);
+  }
+
+  uint64_t stolen = 0;
+  for (size_t i = 0; i < kNumPoolLocalities; ++i) {
+    stolen += pool.NumStolen(static_cast<PoolLocality>(i));
+  }
+
+  // Median also sorts, which Percentile requires.
+  const uint64_t median =
+      robust_statistics::Median(latencies.data(), latencies.size());
+  const uint64_t mad = robust_statistics::MedianAbsoluteDeviation(
+      latencies.data(), latencies.size(), median);
+  const uint64_t imbalance_median =
+      robust_statistics::Median(imbalances.data(), imbalances.size());
+  const uint64_t imbalance_max = imbalances.back();  // sorted by Median
+  const double total_tasks =
+      static_cast<double>(num_tasks) * static_cast<double>(num_runs);
+
+  printf("%zu,%zu,%s,%s,%zu,%zu,%zu,%zu,%zu,%.0f,%.3f,%.3f,%.4f\n",
+         num_workers, static_cast<size_t>(num_tasks), WaitModeName(mode),
+         CostName(cost), num_runs, static_cast<size_t>(median),
+         static_cast<size_t>(Percentile(latencies, 0.99)),
+         static_cast<size_t>(Percentile(latencies, 0.999)),
+         static_cast<size_t>(mad), total_tasks / total_seconds,
+         static_cast<double>(imbalance_median) * 1E-3,
+         static_cast<double>(imbalance_max) * 1E-3,
+         static_cast<double>(stolen) / total_tasks);
+  fflush(stdout);
+}
+
+// Thread counts are powers of two plus the total, up to the number of logical
+// processors available to us, because oversubscription distorts latencies.
+std::vector<size_t> ThreadCounts() {
+  const size_t max_threads = ThreadPool::MaxThreads() + 1;
+  std::vector<size_t> counts;
+  for (size_t num = 1; num < max_threads; num *= 2) {
+    counts.push_back(num);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+TEST(BenchThreadPool, BenchForkJoin) {
+  if (!HaveThreadingSupport()) return;
+
+  char cpu100[100];
+  if (platform::GetCpuString(cpu100)) {
+    fprintf(stderr, "%s\n", cpu100);
+  }
+
+  // Enough for p999 in optimized builds.
+  const size_t num_runs = AdjustedReps(1000);
+  PrintHeader();
+  for (size_t num_threads : ThreadCounts()) {
+    ThreadPool pool(num_threads);
+    // One task per worker measures pure fork-join overhead; the others are
+    // "a few hundred" and thousands of tasks as in the ThreadPool comment.
+    const uint64_t task_counts[3] = {pool.NumWorkers(), 300, 3000};
+    for (PoolWaitMode mode : {PoolWaitMode::kBlock, PoolWaitMode::kSpin,
+                              PoolWaitMode::kAdaptive}) {
+      for (uint64_t num_tasks : task_counts) {
+        for (Cost cost : {Cost::kUniform, Cost::kIncreasing, Cost::kRare}) {
+          BenchConfig(pool, mode, num_tasks, cost, num_runs);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace hwy
+
+HWY_TEST_MAIN();
@@ -0,0 +1,353 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HIGHWAY_HWY_CONTRIB_THREAD_POOL_PIPELINE_H_
+#define HIGHWAY_HWY_CONTRIB_THREAD_POOL_PIPELINE_H_
+
+// Streaming pipeline of serial and parallel stages on a ThreadPool. Unlike a
+// sequence of `Run`, there is no barrier between stages: each token (a buffer
+// plus metadata) proceeds to the next stage as soon as it is ready, so that
+// stages overlap.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <initializer_list>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/cache_control.h"  // Pause
+#include "hwy/contrib/thread_pool/thread_pool.h"
+
+namespace hwy {
+
+// Bounded lock-free multi-producer multi-consumer queue of 32-bit values,
+// see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue.
+// Each cell has a sequence number that indicates whether it is ready for the
+// producer or consumer at a given position.
+class PipelineQueue {
+  struct Cell {
+    std::atomic<uint64_t> seq;
+    uint32_t value;
+  };
+
+ public:
+  // `capacity` is rounded up to a power of two.
+  explicit PipelineQueue(size_t capacity)
+      : mask_(size_t{1} << CeilLog2(HWY_MAX(capacity, size_t{2}))) {
+    cells_ = MakeUniqueAlignedArray<Cell>(mask_);
+    HWY_ASSERT(cells_);
+    for (size_t i = 0; i < mask_; ++i) {
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    mask_ -= 1;
+  }
+
+  // Returns false if full.
+  bool TryPush(uint32_t value) {
+    uint64_t pos = push_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const uint64_t seq = cell->seq.load(std::memory_order_acquire);
+      if (seq == pos) {
+        if (push_pos_.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+          break;
+        }  // else: pos was updated, retry.
+      } else if (seq < pos) {
+        return false;  // still holds the value from pos - capacity
+      } else {
+        pos = push_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = value;
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Returns false if empty.
+  bool TryPop(uint32_t& value) {
+    uint64_t pos = pop_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const uint64_t seq = cell->seq.load(std::memory_order_acquire);
+      if (seq == pos + 1) {
+        if (pop_pos_.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (seq < pos + 1) {
+        return false;
+      } else {
+        pos = pop_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    value = cell->value;
+    cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  size_t mask_;
+  AlignedUniquePtr<Cell[]> cells_;
+  alignas(HWY_ALIGNMENT) std::atomic<uint64_t> push_pos_{0};
+  alignas(HWY_ALIGNMENT) std::atomic<uint64_t> pop_pos_{0};
+};
+
+// Unit of work passed between stages.
+struct PipelineToken {
+  uint8_t* buffer;  // `Pipeline::BufferBytes()`, aligned to HWY_ALIGNMENT.
+  size_t size;      // Bytes in use; zero when the source receives the token.
+  uint64_t seq;     // Order in which the source produced this token.
+};
+
+// Type-erased reference to a stage closure, which is called as
+// `closure(PipelineToken& token, size_t thread)`. The closure must remain
+// valid until `Pipeline::Run` returns, which is the case for temporaries
+// passed directly to `Run`.
+class PipelineStage {
+ public:
+  typedef void (*Func)(const void* opaque, PipelineToken& token,
+                       size_t thread);
+
+  // At most one thread at a time runs this stage, and tokens arrive in the
+  // order of their `seq`.
+  template <class Closure>
+  static PipelineStage Serial(const Closure& closure) {
+    return PipelineStage(&CallClosure<Closure>, &closure, /*serial=*/true);
+  }
+
+  // Multiple threads may run this stage concurrently, in any order.
+  template <class Closure>
+  static PipelineStage Parallel(const Closure& closure) {
+    return PipelineStage(&CallClosure<Closure>, &closure, /*serial=*/false);
+  }
+
+  void operator()(PipelineToken& token, size_t thread) const {
+    func_(opaque_, token, thread);
+  }
+  bool IsSerial() const { return serial_; }
+
+ private:
+  template <class Closure>
+  static void CallClosure(const void* opaque, PipelineToken& token,
+                          size_t thread) {
+    (*reinterpret_cast<const Closure*>(opaque))(token, thread);
+  }
+
+  PipelineStage(Func func, const void* opaque, bool serial)
+      : func_(func), opaque_(opaque), serial_(serial) {}
+
+  Func func_;
+  const void* opaque_;
+  bool serial_;
+};
+
+// Owns the tokens and their buffers, which are reused by each `Run`. The
+// number of tokens bounds the amount of work in flight: when all are in use,
+// the source waits until the last stage releases one (back-pressure).
+class Pipeline {
+  static constexpr uint32_t kEmpty = ~0u;
+
+  // Input of a stage. Serial stages use a reorder window indexed by `seq`:
+  // because at most `num_tokens` are in flight and none can pass a serial
+  // stage, the tokens waiting for it have distinct `seq % num_tokens`.
+  // Parallel stages use a queue.
+  struct alignas(HWY_ALIGNMENT) StageInput {
+    explicit StageInput(size_t num_tokens)
+        : slots(MakeUniqueAlignedArray<std::atomic<uint32_t>>(num_tokens)),
+          queue(num_tokens) {
+      for (size_t i = 0; i < num_tokens; ++i) {
+        slots[i].store(kEmpty, std::memory_order_relaxed);
+      }
+    }
+
+    AlignedUniquePtr<std::atomic<uint32_t>[]> slots;
+    PipelineQueue queue;
+    alignas(HWY_ALIGNMENT) std::atomic<uint32_t> busy{0};  // serial only
+    uint64_t next_seq = 0;  // serial only, protected by `busy`
+  };
+
+ public:
+  Pipeline(size_t num_tokens, size_t buffer_bytes)
+      : num_tokens_(num_tokens),
+        buffer_bytes_(RoundUpTo(HWY_MAX(buffer_bytes, size_t{1}),
+                                HWY_ALIGNMENT)),
+        free_(num_tokens) {
+    HWY_ASSERT(num_tokens != 0 && num_tokens < kEmpty);
+    buffers_ = AllocateAligned<uint8_t>(num_tokens * buffer_bytes_);
+    HWY_ASSERT(buffers_);
+    tokens_.resize(num_tokens);
+    for (size_t i = 0; i < num_tokens; ++i) {
+      tokens_[i].buffer = buffers_.get() + i * buffer_bytes_;
+    }
+  }
+
+  size_t NumTokens() const { return num_tokens_; }
+  size_t BufferBytes() const { return buffer_bytes_; }
+
+  // Calls `source(token, thread)` serially until it returns false, and passes
+  // each token for which it returned true through `stages` in order. Returns
+  // after the last stage has finished with all tokens. All workers of `pool`
+  // participate and poll for work until then, hence stages should not block.
+  // Not thread-safe; only one `Run` at a time.
+  template <class Source>
+  void Run(ThreadPool& pool, const Source& source,
+           std::initializer_list<PipelineStage> stages) {
+    stages_.assign(stages.begin(), stages.end());
+    inputs_.clear();
+    for (size_t s = 0; s < stages_.size(); ++s) {
+      inputs_.push_back(MakeUniqueAligned<StageInput>(num_tokens_));
+    }
+    for (size_t i = 0; i < num_tokens_; ++i) {
+      HWY_ASSERT(free_.TryPush(static_cast<uint32_t>(i)));
+    }
+    source_busy_.store(0, std::memory_order_relaxed);
+    source_seq_ = 0;
+    in_flight_.store(0, std::memory_order_relaxed);
+    input_done_.store(false, std::memory_order_relaxed);
+    finished_.store(false, std::memory_order_relaxed);
+
+    pool.Run(0, pool.NumWorkers(), [&](uint64_t /*task*/, size_t thread) {
+      size_t idle = 0;
+      while (!finished_.load(std::memory_order_acquire)) {
+        // Prefer later stages so that tokens are released sooner.
+        bool progress = false;
+        for (size_t s = stages_.size(); s != 0 && !progress; --s) {
+          progress = RunStage(s - 1, thread);
+        }
+        if (!progress) progress = RunSource(source, thread);
+        if (progress) {
+          idle = 0;
+        } else if (++idle < 1000) {
+          hwy::Pause();
+        } else {
+          // Long stages or oversubscription: let others run.
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    // Return the tokens to the free list for the next Run.
+    uint32_t token;
+    while (free_.TryPop(token)) {
+    }
+  }
+
+ private:
+  // Returns whether a token was produced or the input ended.
+  template <class Source>
+  bool RunSource(const Source& source, size_t thread) {
+    if (input_done_.load(std::memory_order_acquire)) return false;
+    if (source_busy_.exchange(1, std::memory_order_acquire) != 0) return false;
+
+    bool progress = false;
+    uint32_t token;
+    if (!input_done_.load(std::memory_order_relaxed) && free_.TryPop(token)) {
+      progress = true;
+      PipelineToken& t = tokens_[token];
+      t.size = 0;
+      t.seq = source_seq_;
+      if (source(t, thread)) {
+        ++source_seq_;
+        in_flight_.fetch_add(1);
+        Forward(0, token);
+      } else {
+        HWY_ASSERT(free_.TryPush(token));
+        // seq_cst: either we see the last release, or it sees input_done_.
+        input_done_.store(true);
+        if (in_flight_.load() == 0) {
+          finished_.store(true, std::memory_order_release);
+        }
+      }
+    }
+    source_busy_.store(0, std::memory_order_release);
+    return progress;
+  }
+
+  // Returns whether stage `s` processed any tokens.
+  bool RunStage(size_t s, size_t thread) {
+    StageInput& input = *inputs_[s];
+    uint32_t token;
+    if (!stages_[s].IsSerial()) {
+      if (!input.queue.TryPop(token)) return false;
+      stages_[s](tokens_[token], thread);
+      Forward(s + 1, token);
+      return true;
+    }
+
+    if (input.busy.exchange(1, std::memory_order_acquire) != 0) return false;
+    bool progress = false;
+    for (;;) {
+      std::atomic<uint32_t>& slot = input.slots[input.next_seq % num_tokens_];
+      token = slot.load(std::memory_order_acquire);
+      if (token == kEmpty) break;
+      slot.store(kEmpty, std::memory_order_relaxed);
+      HWY_DASSERT(tokens_[token].seq == input.next_seq);
+      ++input.next_seq;
+      stages_[s](tokens_[token], thread);
+      Forward(s + 1, token);
+      progress = true;
+    }
+    input.busy.store(0, std::memory_order_release);
+    return progress;
+  }
+
+  // Passes `token` to stage `s`, or releases it if there is no such stage.
+  void Forward(size_t s, uint32_t token) {
+    if (s == stages_.size()) {
+      HWY_ASSERT(free_.TryPush(token));
+      if (in_flight_.fetch_sub(1) == 1 && input_done_.load()) {
+        finished_.store(true, std::memory_order_release);
+      }
+      return;
+    }
+
+    StageInput& input = *inputs_[s];
+    if (stages_[s].IsSerial()) {
+      std::atomic<uint32_t>& slot =
+          input.slots[tokens_[token].seq % num_tokens_];
+      HWY_DASSERT(slot.load(std::memory_order_relaxed) == kEmpty);
+      slot.store(token, std::memory_order_release);
+    } else {
+      // Cannot fail because the capacity is at least num_tokens_.
+      HWY_ASSERT(input.queue.TryPush(token));
+    }
+  }
+
+  const size_t num_tokens_;
+  const size_t buffer_bytes_;
+  AlignedFreeUniquePtr<uint8_t[]> buffers_;
+  std::vector<PipelineToken> tokens_;
+  PipelineQueue free_;  // indices of tokens not in flight
+
+  // Only valid during Run.
+  std::vector<PipelineStage> stages_;
+  std::vector<AlignedUniquePtr<StageInput>> inputs_;
+  alignas(HWY_ALIGNMENT) std::atomic<uint32_t> source_busy_{0};
+  uint64_t source_seq_ = 0;  // protected by source_busy_
+  alignas(HWY_ALIGNMENT) std::atomic<uint64_t> in_flight_{0};
+  std::atomic<bool> input_done_{false};
+  std::atomic<bool> finished_{false};
+};
+
+}  // namespace hwy
+
+#endif  // HIGHWAY_HWY_CONTRIB_THREAD_POOL_PIPELINE_H_
@@ -0,0 +1,168 @@
+// Copyright 2024 Google LLC
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hwy/contrib/thread_pool/pipeline.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <thread>  // NOLINT
+#include <vector>
+
+#include "hwy/aligned_allocator.h"
+#include "hwy/base.h"
+#include "hwy/contrib/thread_pool/thread_pool.h"
+#include "hwy/contrib/thread_pool/topology.h"
+#include "hwy/tests/hwy_gtest.h"
+#include "hwy/tests/test_util-inl.h"  // AdjustedReps
+
+namespace hwy {
+namespace {
+using HWY_NAMESPACE::AdjustedReps;
+
+TEST(PipelineTest, TestQueue) {
+  PipelineQueue queue(5);  // rounded up to 8
+  uint32_t value;
+  HWY_ASSERT(!queue.TryPop(value));
+  for (uint32_t i = 0; i < 8; ++i) {
+    HWY_ASSERT(queue.TryPush(i));
+  }
+  HWY_ASSERT(!queue.TryPush(8));
+  for (uint32_t i = 0; i < 8; ++i) {
+    HWY_ASSERT(queue.TryPop(value));
+    HWY_ASSERT_EQ(i, value);
+  }
+  HWY_ASSERT(!queue.TryPop(value));
+}
+
+// Several producers and consumers transfer each value exactly once.
+TEST(PipelineTest, TestQueueConcurrent) {
+  if (!HaveThreadingSupport()) return;
+
+  constexpr uint32_t kNumValues = 20000;
+  PipelineQueue queue(16);
+  std::vector<std::atomic<uint32_t>> received(kNumValues);
+  for (std::atomic<uint32_t>& r : received) r.store(0);
+  std::atomic<uint32_t> num_received{0};
+
+  ThreadPool pool(4);
+  pool.Run(0, 4, [&](uint64_t task, size_t /*thread*/) {
+    if (task < 2) {  // producers
+      for (uint32_t i = static_cast<uint32_t>(task); i < kNumValues; i += 2) {
+        // Yield rather than spin in case threads outnumber cores.
+        while (!queue.TryPush(i)) std::this_thread::yield();
+      }
+    } else {  // consumers
+      uint32_t value;
+      while (num_received.load() < kNumValues) {
+        if (queue.TryPop(value)) {
+          received[value].fetch_add(1);
+          num_received.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+  });
+  for (std::atomic<uint32_t>& r : received) HWY_ASSERT(r.load() == 1);
+}
+
+// Serial stages see tokens in order, all tokens pass all stages, and no more
+// than NumTokens are in flight.
+TEST(PipelineTest, TestStages) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(4);
+  for (size_t num_tokens : {1u, 3u, 16u}) {
+    Pipeline pipeline(num_tokens, 100);
+    HWY_ASSERT(pipeline.BufferBytes() >= 100);
+    for (size_t rep = 0; rep < AdjustedReps(4); ++rep) {
+      const uint64_t num_items = 500 + rep;
+      uint64_t produced = 0;
+      std::atomic<uint64_t> in_flight{0};
+      const auto source = [&](PipelineToken& token, size_t /*thread*/) {
+        HWY_ASSERT(token.size == 0);
+        HWY_ASSERT(IsAligned(token.buffer));
+        if (produced == num_items) return false;
+        HWY_ASSERT(token.seq == produced);
+        HWY_ASSERT(in_flight.fetch_add(1) < num_tokens);
+        CopyBytes(&produced, token.buffer, sizeof(produced));
+        token.size = sizeof(produced);
+        ++produced;
+        return true;
+      };
+
+      // Parallel: squares the value in place.
+      const auto square = [](PipelineToken& token, size_t /*thread*/) {
+        uint64_t value;
+        CopyBytes(token.buffer, &value, sizeof(value));
+        value *= value;
+        CopyBytes(&value, token.buffer, sizeof(value));
+      };
+
+      // Serial: checks order and accumulates.
+      uint64_t next_seq = 0;
+      uint64_t sum = 0;
+      const auto sink = [&](PipelineToken& token, size_t /*thread*/) {
+        HWY_ASSERT(token.seq == next_seq);
+        ++next_seq;
+        HWY_ASSERT(token.size == sizeof(uint64_t));
+        uint64_t value;
+        CopyBytes(token.buffer, &value, sizeof(value));
+        HWY_ASSERT(value == token.seq * token.seq);
+        sum += value;
+        in_flight.fetch_sub(1);
+      };
+
+      pipeline.Run(
+          pool, source,
+          {PipelineStage::Parallel(square), PipelineStage::Serial(sink)});
+      HWY_ASSERT_EQ(num_items, next_seq);
+      HWY_ASSERT_EQ((num_items - 1) * num_items * (2 * num_items - 1) / 6,
+                    sum);
+
+      // Only serial stages, and no stages.
+      next_seq = 0;
+      sum = 0;
+      produced = 0;
+      uint64_t next_square = 0;
+      const auto serial_square = [&](PipelineToken& token, size_t thread) {
+        HWY_ASSERT(token.seq == next_square);
+        ++next_square;
+        square(token, thread);
+      };
+      pipeline.Run(pool, source,
+                   {PipelineStage::Serial(serial_square),
+                    PipelineStage::Serial(sink)});
+      HWY_ASSERT_EQ(num_items, next_square);
+      HWY_ASSERT_EQ(num_items, next_seq);
+
+      produced = 0;
+      in_flight.store(0);
+      pipeline.Run(pool, [&](PipelineToken& token, size_t thread) {
+        const bool more = source(token, thread);
+        if (more) in_flight.fetch_sub(1);
+        return more;
+      }, {});
+      HWY_ASSERT_EQ(num_items, produced);
+    }
+  }
+}
+
+}  // namespace
+}  // namespace hwy
+
+HWY_TEST_MAIN();
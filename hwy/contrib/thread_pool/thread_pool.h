@@ -30,6 +30,7 @@
 // IWYU pragma: end_exports
 
 #include <atomic>
+#include <memory>  // AlignedUniquePtr
 #include <vector>
 
 #include "hwy/aligned_allocator.h"  // HWY_ALIGNMENT
@@ -37,6 +38,7 @@
 #include "hwy/cache_control.h"  // Pause
 #include "hwy/contrib/thread_pool/futex.h"
 #include "hwy/contrib/thread_pool/topology.h"
+#include "hwy/timer.h"
 
 // Temporary NOINLINE for profiling.
 #define HWY_POOL_INLINE HWY_NOINLINE
@@ -118,14 +120,49 @@ class ShuffledIota {
 // We want predictable struct/class sizes so we can reason about cache lines.
 #pragma pack(push, 1)
 
-enum class PoolWaitMode : uint32_t { kBlock, kSpin };
+// kAdaptive spins for a budget calibrated from recent intervals between `Run`,
+// then blocks. This avoids both futex wakes during bursts of `Run` and burning
+// cores while idle.
+enum class PoolWaitMode : uint32_t { kBlock, kSpin, kAdaptive };
+
+// Statistics for one worker, only collected in PoolWaitMode::kAdaptive.
+struct PoolWaitStats {
+  uint64_t num_wakes = 0;       // number of kWork commands received
+  uint64_t num_blocked = 0;     // of which required blocking after spinning
+  uint64_t wake_ns = 0;         // sum of latencies from Broadcast to wake
+  uint64_t spin_wasted_ns = 0;  // sum of spin durations that ended in blocking
+};
+
+// Where a victim is relative to the worker stealing from it, from cheapest to
+// most expensive. kUnknown if the pool was created without worker LPs.
+enum class PoolLocality : uint8_t {
+  kCore,     // SMT sibling, shares L1/L2
+  kCluster,  // shares L3
+  kPackage,  // same socket
+  kRemote,   // other socket
+  kUnknown
+};
+static constexpr size_t kNumPoolLocalities = 5;
+
+// Returns the locality of `b` when `a` steals from it.
+static inline PoolLocality LocalityOf(const Topology::LP& a,
+                                      const Topology::LP& b) {
+  if (a.package != b.package) return PoolLocality::kRemote;
+  if (a.cluster != b.cluster) return PoolLocality::kPackage;
+  if (a.core != b.core) return PoolLocality::kCluster;
+  return PoolLocality::kCore;
+}
 
 // Worker's private working set.
 class PoolWorker {  // HWY_ALIGNMENT bytes
   static constexpr size_t kMaxVictims = 4;
 
  public:
-  PoolWorker(size_t thread, size_t num_workers) {
+  // `lps` is either null, or points to the `Topology::LP` of each of the
+  // `num_workers` workers, in which case victims are chosen in order of
+  // increasing `PoolLocality`, and randomly within each locality.
+  PoolWorker(size_t thread, size_t num_workers,
+             const Topology::LP* lps = nullptr) {
     wait_mode_ = PoolWaitMode::kBlock;
     num_victims_ = static_cast<uint32_t>(HWY_MIN(kMaxVictims, num_workers));
 
@@ -139,11 +176,41 @@ class PoolWorker {  // HWY_ALIGNMENT bytes
 
     // To simplify WorkerRun, our own thread is the first to 'steal' from.
     victims_[0] = static_cast<uint32_t>(thread);
-    for (uint32_t i = 1; i < num_victims_; ++i) {
-      victims_[i] = shuffled_iota.Next(victims_[i - 1], div_workers);
-      HWY_DASSERT(victims_[i] != thread);
+    victim_localities_[0] = PoolLocality::kCore;
+    if (lps == nullptr) {
+      for (uint32_t i = 1; i < num_victims_; ++i) {
+        victims_[i] = shuffled_iota.Next(victims_[i - 1], div_workers);
+        victim_localities_[i] = PoolLocality::kUnknown;
+        HWY_DASSERT(victims_[i] != thread);
+      }
+    } else {
+      // Bucket the first few other workers of each locality, in shuffled
+      // order, then take them from the cheapest buckets.
+      uint32_t candidates[kNumPoolLocalities][kMaxVictims];
+      size_t num_candidates[kNumPoolLocalities] = {0};
+      uint32_t other = victims_[0];
+      for (size_t i = 1; i < num_workers; ++i) {
+        other = shuffled_iota.Next(other, div_workers);
+        HWY_DASSERT(other != thread);
+        const size_t locality =
+            static_cast<size_t>(LocalityOf(lps[thread], lps[other]));
+        if (num_candidates[locality] < kMaxVictims) {
+          candidates[locality][num_candidates[locality]++] = other;
+        }
+      }
+      uint32_t i = 1;
+      for (size_t locality = 0; locality < kNumPoolLocalities; ++locality) {
+        for (size_t c = 0; c < num_candidates[locality]; ++c) {
+          if (i == num_victims_) break;
+          victims_[i] = candidates[locality][c];
+          victim_localities_[i] = static_cast<PoolLocality>(locality);
+          ++i;
+        }
+      }
+      HWY_DASSERT(i == num_victims_);
     }
 
+    ResetStats();
     (void)padding_;
   }
   ~PoolWorker() = default;
@@ -159,6 +226,11 @@ class PoolWorker {  // HWY_ALIGNMENT bytes
     return hwy::Span<const uint32_t>(victims_.data(),
                                      static_cast<size_t>(num_victims_));
   }
+  // Parallel to Victims(); the first is our own thread, hence kCore.
+  PoolLocality VictimLocality(size_t i) const {
+    HWY_DASSERT(i < num_victims_);
+    return victim_localities_[i];
+  }
 
   // Called from main thread in Plan().
   HWY_POOL_SETRANGE_INLINE void SetRange(uint64_t begin, uint64_t end) {
@@ -175,24 +247,105 @@ class PoolWorker {  // HWY_ALIGNMENT bytes
     return begin_.fetch_add(1, std::memory_order_relaxed);
   }
 
+  // For ThreadPool::RunChunks: the remaining chunk indices [begin, end) are
+  // packed into one atomic so that thieves can shrink `end` while the owner
+  // increments `begin`. Chunk indices are less than 2^31, so incrementing
+  // `begin` past `end` does not carry into the upper half.
+  static constexpr uint64_t kMaxChunks = 1ULL << 31;
+
+  // Called from main thread in Plan(), or by the worker itself once its chunks
+  // are exhausted, in which case no other thread modifies them.
+  void SetChunks(uint64_t begin, uint64_t end) {
+    HWY_DASSERT(begin <= end && end <= kMaxChunks);
+    chunks_.store((end << 32) | begin, std::memory_order_release);
+  }
+
+  // Called by the worker itself. Returns false if no chunks remain, otherwise
+  // sets `chunk` to the next one.
+  bool WorkerTakeChunk(uint64_t& chunk) {
+    const uint64_t packed = chunks_.fetch_add(1, std::memory_order_relaxed);
+    chunk = packed & 0xFFFFFFFFu;
+    return chunk < (packed >> 32);
+  }
+
+  // Called by other workers. Returns false if no chunks remain, otherwise
+  // removes the upper half of the remaining chunks and returns them in
+  // [`begin`, `end`).
+  bool StealHalfOfChunks(uint64_t& begin, uint64_t& end) {
+    uint64_t packed = chunks_.load(std::memory_order_acquire);
+    for (;;) {
+      const uint64_t my_begin = packed & 0xFFFFFFFFu;
+      const uint64_t my_end = packed >> 32;
+      if (my_begin >= my_end) return false;
+      const uint64_t remaining = my_end - my_begin;
+      const uint64_t new_end = my_end - (remaining + 1) / 2;
+      if (chunks_.compare_exchange_weak(packed, (new_end << 32) | my_begin,
+                                        std::memory_order_acq_rel)) {
+        begin = new_end;
+        end = my_end;
+        return true;
+      }
+    }
+  }
+
+  // Only called by the worker itself, after it finished stealing from a victim.
+  void WorkerAddStolen(PoolLocality locality, uint64_t num_tasks) {
+    num_stolen_[static_cast<size_t>(locality)] += num_tasks;
+  }
+
+  // Number of tasks this worker stole from others with the given `locality`.
+  // Must not be called concurrently with ThreadPool::Run.
+  uint64_t NumStolen(PoolLocality locality) const {
+    return num_stolen_[static_cast<size_t>(locality)];
+  }
+  // Only called by the worker itself, after receiving a kWork command.
+  void WorkerAddWait(uint64_t wake_ns, bool blocked, uint64_t spin_wasted_ns) {
+    ++wait_stats_.num_wakes;
+    wait_stats_.num_blocked += blocked;
+    wait_stats_.wake_ns += wake_ns;
+    wait_stats_.spin_wasted_ns += spin_wasted_ns;
+  }
+
+  // Must not be called concurrently with ThreadPool::Run.
+  const PoolWaitStats& WaitStats() const { return wait_stats_; }
+
+  void ResetStats() {
+    for (size_t locality = 0; locality < kNumPoolLocalities; ++locality) {
+      num_stolen_[locality] = 0;
+    }
+    wait_stats_ = PoolWaitStats();
+  }
+
  private:
   std::atomic<uint64_t> begin_;
-  std::atomic<uint64_t> end_;  // only changes during SetRange
+  std::atomic<uint64_t> end_;     // only changes during SetRange
+  std::atomic<uint64_t> chunks_;  // only used by RunChunks
 
   std::atomic<PoolWaitMode> wait_mode_;  // (32-bit)
   uint32_t num_victims_;                 // <= kPoolMaxVictims
   std::array<uint32_t, kMaxVictims> victims_;
-
-  uint8_t padding_[HWY_ALIGNMENT - 16 - 8 - sizeof(victims_)];
+  std::array<PoolLocality, kMaxVictims> victim_localities_;
+
+  // Written only by this worker; stored at the end to reduce false sharing
+  // with begin_, which other workers increment.
+  uint8_t padding_[HWY_ALIGNMENT - 24 - 8 - sizeof(victims_) -
+                   sizeof(victim_localities_) - kNumPoolLocalities * 8 -
+                   sizeof(PoolWaitStats)];
+  uint64_t num_stolen_[kNumPoolLocalities];
+  PoolWaitStats wait_stats_;
 };
 static_assert(sizeof(PoolWorker) == HWY_ALIGNMENT, "");
 
 // Modified by main thread, shared with all workers.
-class PoolTasks {  // 32 bytes
+class PoolTasks {  // 52 bytes
+ public:
   // Signature of the (internal) function called from workers(s) for each
   // `task` in the [`begin`, `end`) passed to Run(). Closures (lambdas) do not
   // receive the first argument, which points to the lambda object.
   typedef void (*RunFunc)(const void* opaque, uint64_t task, size_t thread_id);
+  // As above, but for a subrange of tasks, see RunChunks().
+  typedef void (*RangeFunc)(const void* opaque, uint64_t begin, uint64_t end,
+                            size_t thread_id);
 
   // Calls closure(task, thread). Signature must match RunFunc.
   template <class Closure>
@@ -200,15 +353,37 @@ class PoolTasks {  // 32 bytes
     (*reinterpret_cast<const Closure*>(opaque))(task, thread);
   }
 
- public:
-  // Called from main thread in Plan().
+  // Calls closure(begin, end, thread). Signature must match RangeFunc.
   template <class Closure>
-  void Store(const Closure& closure, uint64_t begin, uint64_t end) {
+  static void CallRangeClosure(const void* opaque, uint64_t begin,
+                               uint64_t end, size_t thread) {
+    (*reinterpret_cast<const Closure*>(opaque))(begin, end, thread);
+  }
+
+  // Called from main thread in Plan(). If `no_steal`, workers only run the
+  // tasks assigned to them, see ThreadPool::RunStatic.
+  template <class Closure>
+  void Store(const Closure& closure, uint64_t begin, uint64_t end,
+             bool no_steal = false) {
     const auto rel = std::memory_order_release;
     func_.store(static_cast<RunFunc>(&CallClosure<Closure>), rel);
     opaque_.store(reinterpret_cast<const void*>(&closure), rel);
     begin_.store(begin, rel);
     end_.store(end, rel);
+    grain_.store(0, rel);
+    no_steal_.store(no_steal ? 1 : 0, rel);
+  }
+
+  // Called from main thread in PlanChunks(). `grain` is nonzero.
+  template <class Closure>
+  void StoreChunks(const Closure& closure, uint64_t begin, uint64_t end,
+                   uint64_t grain) {
+    const auto rel = std::memory_order_release;
+    range_func_.store(static_cast<RangeFunc>(&CallRangeClosure<Closure>), rel);
+    opaque_.store(reinterpret_cast<const void*>(&closure), rel);
+    begin_.store(begin, rel);
+    end_.store(end, rel);
+    grain_.store(grain, rel);
   }
 
   RunFunc WorkerGet(uint64_t& begin, uint64_t& end, const void*& opaque) const {
@@ -219,15 +394,29 @@ class PoolTasks {  // 32 bytes
     return func_.load(acq);
   }
 
+  // Returns 0 unless the tasks were stored by StoreChunks.
+  uint64_t WorkerGetGrain() const {
+    return grain_.load(std::memory_order_acquire);
+  }
+  RangeFunc WorkerGetRangeFunc() const {
+    return range_func_.load(std::memory_order_acquire);
+  }
+  bool WorkerGetNoSteal() const {
+    return no_steal_.load(std::memory_order_acquire) != 0;
+  }
+
  private:
   std::atomic<RunFunc> func_;
   std::atomic<const void*> opaque_;
   std::atomic<uint64_t> begin_;
   std::atomic<uint64_t> end_;
+  std::atomic<uint64_t> grain_;
+  std::atomic<RangeFunc> range_func_;
+  std::atomic<uint32_t> no_steal_;
 };
 
 // Modified by main thread, shared with all workers.
-class PoolCommands {  // 16 bytes
+class PoolCommands {  // 24 bytes
   static constexpr uint32_t kInitial = 0;
   static constexpr uint32_t kMask = 0xF;  // for command, rest is ABA counter.
   static constexpr size_t kShift = hwy::CeilLog2(kMask);
@@ -241,6 +430,13 @@ class PoolCommands {  // 16 bytes
   // command as intended.
   static uint32_t WorkerInitialSeqCmd() { return kInitial; }
 
+  // For kAdaptive: called by the main thread before Broadcast(kWork).
+  void SetSpinBudget(double now, double spin_budget) {
+    const auto rel = std::memory_order_release;
+    broadcast_time_.store(now, rel);
+    spin_budget_.store(spin_budget, rel);
+  }
+
   // Sends `cmd` to all workers.
   void Broadcast(uint32_t cmd) {
     HWY_DASSERT(cmd <= kMask);
@@ -248,7 +444,7 @@ class PoolCommands {  // 16 bytes
     const uint32_t seq_cmd = (epoch << kShift) | cmd;
     seq_cmd_.store(seq_cmd, std::memory_order_release);
 
-    // Wake any worker whose wait_mode_ is or was kBlock.
+    // Wake any worker whose wait_mode_ is or was kBlock or kAdaptive.
     WakeAll(seq_cmd_);
 
     // Workers are either starting up, or waiting for a command. Either way,
@@ -256,11 +452,14 @@ class PoolCommands {  // 16 bytes
   }
 
   // Returns the command, i.e., one of the public constants, e.g., kTerminate.
+  // For kAdaptive, also updates the statistics of `worker`.
   uint32_t WorkerWaitForNewCommand(PoolWaitMode wait_mode,
-                                   uint32_t& prev_seq_cmd) {
+                                   uint32_t& prev_seq_cmd, PoolWorker& worker) {
     uint32_t seq_cmd;
     if (HWY_LIKELY(wait_mode == PoolWaitMode::kSpin)) {
       seq_cmd = SpinUntilDifferent(prev_seq_cmd, seq_cmd_);
+    } else if (wait_mode == PoolWaitMode::kAdaptive) {
+      seq_cmd = AdaptiveUntilDifferent(prev_seq_cmd, worker);
     } else {
       seq_cmd = BlockUntilDifferent(prev_seq_cmd, seq_cmd_);
     }
@@ -278,11 +477,53 @@ class PoolCommands {  // 16 bytes
     }
   }
 
+  // Spins until the budget is exhausted, then blocks.
+  HWY_INLINE uint32_t AdaptiveUntilDifferent(const uint32_t prev_seq_cmd,
+                                             PoolWorker& worker) {
+    const auto acq = std::memory_order_acquire;
+    const double t0 = platform::Now();
+    const double spin_budget = spin_budget_.load(acq);
+    bool blocked = false;
+    double spin_wasted = 0.0;
+    uint32_t seq_cmd;
+    for (size_t rep = 0;; ++rep) {
+      hwy::Pause();
+      seq_cmd = seq_cmd_.load(acq);
+      if (seq_cmd != prev_seq_cmd) break;
+      // Amortize the cost of reading the timer.
+      if ((rep & 15) == 15) {
+        const double elapsed = platform::Now() - t0;
+        if (elapsed >= spin_budget) {
+          spin_wasted = elapsed;
+          blocked = true;
+          seq_cmd = BlockUntilDifferent(prev_seq_cmd, seq_cmd_);
+          break;
+        }
+      }
+    }
+
+    if ((seq_cmd & kMask) == kWork) {
+      // The broadcast time is stored before seq_cmd_, hence is visible now.
+      const double wake = platform::Now() - broadcast_time_.load(acq);
+      worker.WorkerAddWait(ToNanoseconds(wake), blocked,
+                           ToNanoseconds(spin_wasted));
+    }
+    return seq_cmd;
+  }
+
+  static uint64_t ToNanoseconds(double seconds) {
+    // Timers of different cores are not necessarily synchronized.
+    return seconds <= 0.0 ? 0 : static_cast<uint64_t>(seconds * 1E9);
+  }
+
   // Counter for ABA-proofing WorkerWaitForNewCommand. Stored next to seq_cmd_
   // because both are written at the same time by the main thread. Sharding this
   // 4x (one per cache line) is not helpful.
   uint32_t epoch_{0};
   std::atomic<uint32_t> seq_cmd_{kInitial};
+  // Only used for kAdaptive.
+  std::atomic<double> broadcast_time_{0.0};
+  std::atomic<double> spin_budget_{0.0};
 };
 
 // Modified by main thread AND workers.
@@ -302,17 +543,22 @@ class alignas(HWY_ALIGNMENT) PoolBarrier {  // 4 * HWY_ALIGNMENT bytes
     num_finished_[i * kU64PerCacheLine].fetch_add(1, std::memory_order_release);
   }
 
+  // Returns whether all have called Arrive().
+  bool AllArrived(size_t num_workers) const {
+    const auto acq = std::memory_order_acquire;
+    const uint64_t sum = num_finished_[0 * kU64PerCacheLine].load(acq) +
+                         num_finished_[1 * kU64PerCacheLine].load(acq) +
+                         num_finished_[2 * kU64PerCacheLine].load(acq) +
+                         num_finished_[3 * kU64PerCacheLine].load(acq);
+    return sum == num_workers;
+  }
+
   // Spin until all have called Arrive(). Note that workers spin for a new
   // command, not the barrier itself.
   HWY_POOL_INLINE void WaitAll(size_t num_workers) {
-    const auto acq = std::memory_order_acquire;
     for (;;) {
       hwy::Pause();
-      const uint64_t sum = num_finished_[0 * kU64PerCacheLine].load(acq) +
-                           num_finished_[1 * kU64PerCacheLine].load(acq) +
-                           num_finished_[2 * kU64PerCacheLine].load(acq) +
-                           num_finished_[3 * kU64PerCacheLine].load(acq);
-      if (sum == num_workers) break;
+      if (AllArrived(num_workers)) break;
     }
   }
 
@@ -321,38 +567,203 @@ class alignas(HWY_ALIGNMENT) PoolBarrier {  // 4 * HWY_ALIGNMENT bytes
   std::atomic<uint64_t> num_finished_[4 * kU64PerCacheLine];
 };
 
+// Parallel-for submitted to a busy pool in concurrent mode, see
+// ThreadPool::SetConcurrent. Resides on the submitter's stack, hence there is
+// no allocation. Any thread may run its tasks.
+class alignas(HWY_ALIGNMENT) PoolRegion {
+ public:
+  template <class Closure>
+  PoolRegion(const Closure& closure, uint64_t begin, uint64_t end)
+      : func_(&PoolTasks::CallClosure<Closure>),
+        opaque_(reinterpret_cast<const void*>(&closure)),
+        end_(end),
+        num_tasks_(end - begin),
+        next_(begin),
+        num_done_(0) {
+    HWY_DASSERT(begin <= end);
+  }
+
+  // Runs one task on `thread` and returns true, or false if none remain.
+  bool RunOne(size_t thread) {
+    const uint64_t task = next_.fetch_add(1, std::memory_order_relaxed);
+    if (task >= end_) return false;
+    func_(opaque_, task, thread);
+    num_done_.fetch_add(1, std::memory_order_release);
+    return true;
+  }
+
+  // Whether all tasks have finished, not just started.
+  bool IsDone() const {
+    return num_done_.load(std::memory_order_acquire) == num_tasks_;
+  }
+
+ private:
+  const PoolTasks::RunFunc func_;
+  const void* const opaque_;
+  const uint64_t end_;
+  const uint64_t num_tasks_;
+  // Other threads increment these, hence separate cache line.
+  alignas(HWY_ALIGNMENT) std::atomic<uint64_t> next_;
+  std::atomic<uint64_t> num_done_;
+};
+
+// Slots in which submitters publish their PoolRegion so that other threads
+// help with their tasks.
+class alignas(HWY_ALIGNMENT) PoolRegions {
+ public:
+  static constexpr size_t kMaxRegions = 32;
+
+  PoolRegions() {
+    for (Slot& slot : slots_) {
+      slot.region.store(nullptr, std::memory_order_relaxed);
+      slot.refs.store(0, std::memory_order_relaxed);
+      (void)slot.padding;
+    }
+    (void)padding_;
+  }
+
+  // Returns the slot index, or kMaxRegions if all are occupied.
+  size_t Publish(PoolRegion* region) {
+    for (size_t i = 0; i < kMaxRegions; ++i) {
+      PoolRegion* expected = nullptr;
+      if (slots_[i].region.compare_exchange_strong(expected, region)) {
+        num_active_.fetch_add(1);
+        return i;
+      }
+    }
+    return kMaxRegions;
+  }
+
+  // Stops others from accessing the region in slot `i`. Afterwards, the region
+  // may be destroyed.
+  void Unpublish(size_t i) {
+    HWY_DASSERT(i < kMaxRegions);
+    num_active_.fetch_sub(1);
+    slots_[i].region.store(nullptr);
+    // Wait for helpers that already loaded the pointer.
+    while (slots_[i].refs.load() != 0) {
+      hwy::Pause();
+    }
+  }
+
+  // Runs tasks of published regions on `thread`. Returns whether any ran.
+  bool Help(size_t thread) {
+    if (num_active_.load(std::memory_order_relaxed) == 0) return false;
+    bool any = false;
+    for (Slot& slot : slots_) {
+      // Avoid modifying refs of unused slots.
+      if (slot.region.load(std::memory_order_relaxed) == nullptr) continue;
+      // Increment before loading the pointer again, see Unpublish.
+      slot.refs.fetch_add(1);
+      PoolRegion* region = slot.region.load();
+      if (region != nullptr) {
+        while (region->RunOne(thread)) {
+          any = true;
+        }
+      }
+      slot.refs.fetch_sub(1);
+    }
+    return any;
+  }
+
+ private:
+  struct Slot {  // 16 bytes
+    std::atomic<PoolRegion*> region;
+    std::atomic<uint32_t> refs;
+    uint32_t padding;
+  };
+  Slot slots_[kMaxRegions];
+  std::atomic<uint32_t> num_active_{0};
+  uint8_t padding_[HWY_ALIGNMENT - sizeof(uint32_t)];
+};
+
+// Identifies the pool and worker index of the current thread, which may be
+// one of its workers, or any thread currently calling Run. Only used in
+// concurrent mode.
+struct PoolThreadContext {
+  const void* mem = nullptr;  // PoolMem of the pool, or null.
+  size_t thread = 0;
+};
+
+// Not static so that all translation units share the same instance.
+inline PoolThreadContext& CurrentPoolThread() {
+  static thread_local PoolThreadContext context;
+  return context;
+}
+
 // All mutable pool and worker state.
 struct alignas(HWY_ALIGNMENT) PoolMem {
   PoolWorker& Worker(size_t thread) {
-    return *reinterpret_cast<PoolWorker*>(reinterpret_cast<uint8_t*>(&barrier) +
-                                          sizeof(barrier) +
-                                          thread * sizeof(PoolWorker));
+    return *reinterpret_cast<PoolWorker*>(reinterpret_cast<uint8_t*>(this) +
+                                          worker_offset +
+                                          thread * worker_stride);
+  }
+
+  // Called by pinned worker `thread`. If PoolMemOwner gave each worker its own
+  // pages, migrates them to the current NUMA node. Returns whether this
+  // happened.
+  bool WorkerBindToNode(size_t thread) {
+    if (worker_stride == sizeof(PoolWorker)) return false;
+    const size_t node = CurrentNode();
+    if (node == kUnknownNode) return false;
+    return BindMemoryToNode(&Worker(thread), worker_stride, node);
   }
 
   PoolTasks tasks;
   PoolCommands commands;
+  // Set by PoolMemOwner; workers are at least sizeof(PoolWorker) apart, or a
+  // page if they are placed on different NUMA nodes.
+  uint32_t worker_offset;
+  uint32_t worker_stride;
   // barrier is more write-heavy, hence keep in another cache line.
-  uint8_t padding[HWY_ALIGNMENT - sizeof(tasks) - sizeof(commands)];
+  uint8_t padding[HWY_ALIGNMENT - sizeof(tasks) - sizeof(commands) -
+                  2 * sizeof(uint32_t)];
 
   PoolBarrier barrier;
   static_assert(sizeof(barrier) % HWY_ALIGNMENT == 0, "");
 
+  PoolRegions regions;
+  static_assert(sizeof(regions) % HWY_ALIGNMENT == 0, "");
+
   // Followed by `num_workers` PoolWorker.
 };
 
 // Aligned allocation and initialization of variable-length PoolMem.
 class PoolMemOwner {
  public:
-  explicit PoolMemOwner(size_t num_threads)
+  // `lps` is either empty or has one entry per worker, see PoolWorker.
+  explicit PoolMemOwner(size_t num_threads,
+                        const std::vector<Topology::LP>& lps = {})
       // There is at least one worker, the main thread.
       : num_workers_(HWY_MAX(num_threads, size_t{1})) {
-    const size_t size = sizeof(PoolMem) + num_workers_ * sizeof(PoolWorker);
+    HWY_ASSERT(lps.empty() || lps.size() == num_workers_);
+    // If workers span multiple NUMA nodes (or packages, in case nodes are
+    // unknown), give each its own pages so that WorkerBindToNode can migrate
+    // them to the node of that worker.
+    size_t stride = sizeof(PoolWorker);
+    size_t page = 0;
+    for (const Topology::LP& lp : lps) {
+      if (lp.node != lps[0].node || lp.package != lps[0].package) {
+        page = PageBytes();
+        stride = RoundUpTo(sizeof(PoolWorker), page);
+        break;
+      }
+    }
+    const size_t size = sizeof(PoolMem) + page + num_workers_ * stride;
     bytes_ = hwy::AllocateAligned<uint8_t>(size);
     HWY_ASSERT(bytes_);
     mem_ = new (bytes_.get()) PoolMem();
+    size_t offset = sizeof(PoolMem);
+    if (page != 0) {
+      const size_t addr = reinterpret_cast<uintptr_t>(bytes_.get());
+      offset = RoundUpTo(addr + offset, page) - addr;
+    }
+    mem_->worker_offset = static_cast<uint32_t>(offset);
+    mem_->worker_stride = static_cast<uint32_t>(stride);
 
     for (size_t thread = 0; thread < num_workers_; ++thread) {
-      new (&mem_->Worker(thread)) PoolWorker(thread, num_workers_);
+      new (&mem_->Worker(thread))
+          PoolWorker(thread, num_workers_, lps.empty() ? nullptr : &lps[0]);
     }
 
     // Publish non-atomic stores in mem_ - that is the only shared state workers
@@ -401,7 +812,8 @@ class ParallelFor {  // 0 bytes
   // spinning for a command. Returns false if there are no tasks or workers.
   template <class Closure>
   static bool Plan(uint64_t begin, uint64_t end, size_t num_workers,
-                   const Closure& closure, PoolMem& mem) {
+                   const Closure& closure, PoolMem& mem,
+                   bool no_steal = false) {
     // If there are no tasks, we are done.
     HWY_DASSERT(begin <= end);
     const size_t num_tasks = static_cast<size_t>(end - begin);
@@ -418,7 +830,7 @@ class ParallelFor {  // 0 bytes
 
     // Store for later retrieval by all workers in WorkerRun. Must happen after
     // the loop above because it may be re-entered by concurrent threads.
-    mem.tasks.Store(closure, begin, end);
+    mem.tasks.Store(closure, begin, end, no_steal);
 
     // Assigning all remainders to the last thread causes imbalance. We instead
     // give one more to each thread whose index is less.
@@ -435,8 +847,70 @@ class ParallelFor {  // 0 bytes
     return true;
   }
 
+  // Returns the worker to which Plan assigns the task with zero-based index
+  // `task_index`, or 0 if `num_workers` <= 1. Matches the partition in Plan:
+  // the first `num_tasks % num_workers` workers receive one extra task.
+  static size_t StaticThread(uint64_t task_index, uint64_t num_tasks,
+                             size_t num_workers) {
+    HWY_DASSERT(task_index < num_tasks);
+    if (num_workers <= 1) return 0;
+    const uint64_t min_tasks = num_tasks / num_workers;
+    const uint64_t remainder = num_tasks % num_workers;
+    const uint64_t boundary = remainder * (min_tasks + 1);
+    if (task_index < boundary) {
+      return static_cast<size_t>(task_index / (min_tasks + 1));
+    }
+    return static_cast<size_t>(remainder + (task_index - boundary) / min_tasks);
+  }
+
+  // Returns the number of tasks per chunk for RunChunks. If `grain` is zero,
+  // chooses one such that each worker initially receives a few chunks, which
+  // is enough because thieves steal half of the remaining chunks.
+  static uint64_t ChunkSize(uint64_t num_tasks, uint64_t grain,
+                            size_t num_workers) {
+    constexpr uint64_t kChunksPerWorker = 8;
+    if (grain == 0) grain = DivCeil(num_tasks, num_workers * kChunksPerWorker);
+    // Ensure the number of chunks fits in PoolWorker.
+    return HWY_MAX(HWY_MAX(grain, DivCeil(num_tasks, PoolWorker::kMaxChunks)),
+                   uint64_t{1});
+  }
+
+  // Same as Plan, but for `closure(range_begin, range_end, thread)` on chunks
+  // of `grain` tasks, or an automatically chosen size if `grain` is zero.
+  template <class Closure>
+  static bool PlanChunks(uint64_t begin, uint64_t end, uint64_t grain,
+                         size_t num_workers, const Closure& closure,
+                         PoolMem& mem) {
+    HWY_DASSERT(begin <= end);
+    const uint64_t num_tasks = end - begin;
+    if (HWY_UNLIKELY(num_tasks == 0)) return false;
+
+    grain = ChunkSize(num_tasks, grain, num_workers);
+
+    if (HWY_UNLIKELY(num_workers <= 1)) {
+      for (uint64_t task = begin; task < end; task += grain) {
+        closure(task, HWY_MIN(task + grain, end), /*thread=*/0);
+      }
+      return false;
+    }
+
+    mem.tasks.StoreChunks(closure, begin, end, grain);
+
+    const uint64_t num_chunks = DivCeil(num_tasks, grain);
+    const uint64_t remainder = num_chunks % num_workers;
+    const uint64_t min_chunks = num_chunks / num_workers;
+    uint64_t chunk = 0;
+    for (size_t thread = 0; thread < num_workers; ++thread) {
+      const uint64_t my_end = chunk + min_chunks + (thread < remainder);
+      mem.Worker(thread).SetChunks(chunk, my_end);
+      chunk = my_end;
+    }
+    HWY_DASSERT(chunk == num_chunks);
+    return true;
+  }
+
   // Must be called for each `thread` in [0, num_workers), but only if
-  // Plan returned true.
+  // Plan or PlanChunks returned true.
   static HWY_POOL_INLINE void WorkerRun(const size_t thread, size_t num_workers,
                                         PoolMem& mem) {
     // Nonzero, otherwise Plan returned false and this should not be called.
@@ -444,6 +918,8 @@ class ParallelFor {  // 0 bytes
     HWY_DASSERT(thread < num_workers);
 
     const PoolTasks& tasks = mem.tasks;
+    const uint64_t grain = tasks.WorkerGetGrain();
+    if (HWY_UNLIKELY(grain != 0)) return WorkerRunChunks(thread, grain, mem);
 
     uint64_t begin, end;
     const void* opaque;
@@ -458,12 +934,26 @@ class ParallelFor {  // 0 bytes
       return;
     }
 
+    PoolWorker& worker = mem.Worker(thread);
+    if (HWY_UNLIKELY(tasks.WorkerGetNoSteal())) {
+      // Only our own tasks, in ascending order. No other thread increments
+      // our counter, hence this could also be a non-atomic loop.
+      const uint64_t my_end = worker.WorkerGetEnd();
+      for (uint64_t task = worker.WorkerReserveTask(); task < my_end;
+           task = worker.WorkerReserveTask()) {
+        func(opaque, task, thread);
+      }
+      return;
+    }
+
     // For each worker in random order, attempt to do all their work.
-    for (uint32_t victim : mem.Worker(thread).Victims()) {
-      PoolWorker* other_worker = &mem.Worker(victim);
+    const hwy::Span<const uint32_t> victims = worker.Victims();
+    for (size_t i = 0; i < victims.size(); ++i) {
+      PoolWorker* other_worker = &mem.Worker(victims[i]);
 
       // Until all of other_worker's work is done:
       const uint64_t end = other_worker->WorkerGetEnd();
+      uint64_t num_tasks = 0;
       for (;;) {
         // On x86 this generates a LOCK prefix, but that is only expensive if
         // there is actually contention, which is unlikely because we shard the
@@ -483,9 +973,55 @@ class ParallelFor {  // 0 bytes
         // `thread` is the one we are actually running on; this is important
         // because it is the TLS index for user code.
         func(opaque, task, thread);
+        ++num_tasks;
+      }
+      // Only count actual steals, not our own tasks.
+      if (i != 0 && num_tasks != 0) {
+        worker.WorkerAddStolen(worker.VictimLocality(i), num_tasks);
       }
     }
   }
+
+ private:
+  // Runs our own chunks. When they are exhausted, steals half of the remaining
+  // chunks of the first victim that has any, and makes them our own so that
+  // others may in turn steal from us. Every chunk is thus owned by a worker
+  // that has not yet returned, and it returns only when no victim has chunks.
+  static HWY_POOL_INLINE void WorkerRunChunks(const size_t thread,
+                                              uint64_t grain, PoolMem& mem) {
+    const PoolTasks& tasks = mem.tasks;
+    uint64_t begin, end;
+    const void* opaque;
+    (void)tasks.WorkerGet(begin, end, opaque);
+    const PoolTasks::RangeFunc func = tasks.WorkerGetRangeFunc();
+
+    PoolWorker& worker = mem.Worker(thread);
+    const hwy::Span<const uint32_t> victims = worker.Victims();
+    for (;;) {
+      uint64_t chunk;
+      while (worker.WorkerTakeChunk(chunk)) {
+        const uint64_t task = begin + chunk * grain;
+        func(opaque, task, HWY_MIN(task + grain, end), thread);
+      }
+
+      // victims[0] is our own thread.
+      size_t i = 1;
+      uint64_t stolen_begin = 0, stolen_end = 0;
+      for (; i < victims.size(); ++i) {
+        PoolWorker& victim = mem.Worker(victims[i]);
+        if (victim.StealHalfOfChunks(stolen_begin, stolen_end)) break;
+        hwy::Pause();  // Reduce coherency traffic while stealing.
+      }
+      if (i == victims.size()) return;
+
+      // Chunks are not yet visible to others, so count before publishing.
+      const uint64_t stolen_tasks =
+          HWY_MIN(begin + stolen_end * grain, end) -
+          (begin + stolen_begin * grain);
+      worker.WorkerAddStolen(worker.VictimLocality(i), stolen_tasks);
+      worker.SetChunks(stolen_begin, stolen_end);
+    }
+  }
 };
 
 #pragma pack(pop)
@@ -506,6 +1042,180 @@ static inline void SetThreadName(const char* format, int thread) {
 #endif
 }
 
+// Handle for a job started via `ThreadPool::Submit`. Cheap to copy; must not
+// outlive the pool.
+class PoolJobHandle {
+ public:
+  static constexpr uint64_t kMaxJobs = 64;  // ring capacity of PoolJobs
+
+  // Default: a job that already ran on the submitting thread.
+  PoolJobHandle() = default;
+  PoolJobHandle(const std::atomic<uint64_t>* seq, uint64_t ticket)
+      : seq_(seq), ticket_(ticket) {}
+
+  // The slot's sequence number only increases, and reaches `ticket + kMaxJobs`
+  // once the job has finished and the slot is free for reuse.
+  bool IsDone() const {
+    return seq_ == nullptr ||
+           seq_->load(std::memory_order_acquire) >= ticket_ + kMaxJobs;
+  }
+
+  // Returns after the job finished; its side effects are then visible.
+  void Wait() const {
+    for (size_t reps = 0; !IsDone(); ++reps) {
+      if (reps < 1000) {
+        hwy::Pause();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+ private:
+  const std::atomic<uint64_t>* seq_ = nullptr;
+  uint64_t ticket_ = 0;
+};
+
+// Bounded multi-producer multi-consumer ring of jobs plus the threads that run
+// them. Closures are copied into preallocated slots, which avoids the
+// allocations of std::function. Jobs run in place and the slot is released
+// only afterwards, so that `PoolJobHandle` can detect completion from the
+// slot's sequence number. Separate threads (rather than the pool's workers)
+// run the jobs, so that a long job does not delay the barrier of `Run`.
+class alignas(HWY_ALIGNMENT) PoolJobs {
+  static constexpr uint64_t kMaxJobs = PoolJobHandle::kMaxJobs;
+
+  struct alignas(HWY_ALIGNMENT) Slot {
+    std::atomic<uint64_t> seq;
+    void (*run)(void* closure);  // also destroys the closure
+    alignas(16) uint8_t closure[HWY_ALIGNMENT - 16];
+  };
+  static_assert(sizeof(Slot) == HWY_ALIGNMENT, "Slot size mismatch");
+
+  template <class Closure>
+  static void RunAndDestroy(void* storage) {
+    Closure* closure = reinterpret_cast<Closure*>(storage);
+    (*closure)();
+    closure->~Closure();
+  }
+
+  static void ThreadFunc(size_t thread, PoolJobs* jobs) {
+    SetThreadName("job%03d", static_cast<int>(thread));
+    for (;;) {
+      const uint32_t prev = jobs->num_notified_.load(std::memory_order_acquire);
+      if (jobs->RunOne()) continue;
+      // Only exit once all submitted jobs have run.
+      if (jobs->stop_.load(std::memory_order_acquire)) return;
+      jobs->num_waiting_.fetch_add(1);
+      // Returns immediately if a job was submitted since loading `prev`.
+      (void)BlockUntilDifferent(prev, jobs->num_notified_);
+      jobs->num_waiting_.fetch_sub(1);
+    }
+  }
+
+ public:
+  static constexpr size_t kMaxClosureBytes = sizeof(Slot::closure);
+
+  explicit PoolJobs(size_t num_threads) {
+    for (uint64_t i = 0; i < kMaxJobs; ++i) {
+      slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    threads_.reserve(num_threads);
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+      threads_.emplace_back(ThreadFunc, thread, this);
+    }
+  }
+
+  // Runs all pending jobs, then waits for the threads to exit.
+  ~PoolJobs() {
+    stop_.store(true, std::memory_order_release);
+    Notify();
+    for (std::thread& thread : threads_) {
+      HWY_ASSERT(thread.joinable());
+      thread.join();
+    }
+  }
+
+  PoolJobs(const PoolJobs&) = delete;
+  PoolJobs& operator=(const PoolJobs&) = delete;
+
+  size_t NumThreads() const { return threads_.size(); }
+
+  // Thread-safe. If the ring is full, runs `closure` on the calling thread,
+  // which provides back-pressure.
+  template <class Closure>
+  PoolJobHandle Submit(const Closure& closure) {
+    static_assert(sizeof(Closure) <= kMaxClosureBytes,
+                  "Closure too large, capture a pointer instead");
+    static_assert(alignof(Closure) <= 16, "Closure alignment too large");
+
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+      slot = &slots_[pos % kMaxJobs];
+      const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+      if (seq == pos) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }  // else: pos was updated, retry.
+      } else if (seq < pos) {  // slot still holds the job from pos - kMaxJobs
+        closure();
+        return PoolJobHandle();
+      } else {  // another producer claimed pos
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    new (slot->closure) Closure(closure);
+    slot->run = &RunAndDestroy<Closure>;
+    slot->seq.store(pos + 1, std::memory_order_release);  // publish
+    Notify();
+    return PoolJobHandle(&slot->seq, pos);
+  }
+
+ private:
+  // Returns false if there were no pending jobs.
+  bool RunOne() {
+    uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+      slot = &slots_[pos % kMaxJobs];
+      const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+      if (seq == pos + 1) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (seq < pos + 1) {
+        return false;  // empty
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    slot->run(slot->closure);
+    // Marks the job as done and frees the slot for pos + kMaxJobs.
+    slot->seq.store(pos + kMaxJobs, std::memory_order_release);
+    return true;
+  }
+
+  // Both accesses are seq_cst: either we see the waiter, or it sees the
+  // incremented counter and does not block.
+  void Notify() {
+    num_notified_.fetch_add(1);
+    if (num_waiting_.load() != 0) WakeAll(num_notified_);
+  }
+
+  Slot slots_[kMaxJobs];
+  alignas(HWY_ALIGNMENT) std::atomic<uint64_t> enqueue_pos_{0};
+  alignas(HWY_ALIGNMENT) std::atomic<uint64_t> dequeue_pos_{0};
+  alignas(HWY_ALIGNMENT) std::atomic<uint32_t> num_notified_{0};
+  std::atomic<uint32_t> num_waiting_{0};
+  std::atomic<bool> stop_{false};
+  std::vector<std::thread> threads_;
+};
+
 // Highly efficient parallel-for, intended for workloads with thousands of
 // fork-join regions which consist of calling tasks[t](i) for a few hundred i,
 // using dozens of threads.
@@ -524,9 +1234,18 @@ static inline void SetThreadName(const char* format, int thread) {
 //
 // For load-balancing, we use work stealing in random order.
 class ThreadPool {
-  static void ThreadFunc(size_t thread, size_t num_workers, PoolMem* mem) {
+  // `lp` is the logical processor to pin to, or `kMaxLogicalProcessors`.
+  static void ThreadFunc(size_t thread, size_t num_workers, size_t lp,
+                         PoolMem* mem) {
     HWY_DASSERT(thread < num_workers);
     SetThreadName("worker%03zu", static_cast<int>(thread));
+    if (lp != kMaxLogicalProcessors) {
+      if (PinThreadToLogicalProcessor(lp)) {
+        (void)mem->WorkerBindToNode(thread);
+      } else {
+        fprintf(stderr, "Pinning worker %zu to LP %zu failed\n", thread, lp);
+      }
+    }
 
     // Ensure mem is ready to use (synchronize with PoolMemOwner's fence).
     std::atomic_thread_fence(std::memory_order_acquire);
@@ -535,14 +1254,21 @@ class ThreadPool {
     PoolCommands& commands = mem->commands;
     uint32_t prev_seq_cmd = PoolCommands::WorkerInitialSeqCmd();
 
+    // For nested Run in concurrent mode.
+    CurrentPoolThread().mem = mem;
+    CurrentPoolThread().thread = thread;
+
     for (;;) {
       const PoolWaitMode wait_mode = worker.WorkerGetWaitMode();
       const uint32_t command =
-          commands.WorkerWaitForNewCommand(wait_mode, prev_seq_cmd);
+          commands.WorkerWaitForNewCommand(wait_mode, prev_seq_cmd, worker);
       if (HWY_UNLIKELY(command == PoolCommands::kTerminate)) {
         return;  // exits thread
       } else if (HWY_LIKELY(command == PoolCommands::kWork)) {
         ParallelFor::WorkerRun(thread, num_workers, *mem);
+        // Before arriving, help with any concurrent or nested regions.
+        while (mem->regions.Help(thread)) {
+        }
         mem->barrier.WorkerArrive(thread);
       } else if (command == PoolCommands::kNop) {
         // do nothing - used to change wait mode
@@ -576,7 +1302,25 @@ class ThreadPool {
     // PoolCommands once ready.
     threads_.reserve(num_workers - 1);
     for (size_t thread = 0; thread < num_workers - 1; ++thread) {
-      threads_.emplace_back(ThreadFunc, thread, num_workers, owner_.Mem());
+      threads_.emplace_back(ThreadFunc, thread, num_workers,
+                            kMaxLogicalProcessors, owner_.Mem());
+    }
+  }
+
+  // Creates `worker_lps.size()` workers and pins worker `thread` to logical
+  // processor `worker_lps[thread]`. Work stealing then prefers victims that
+  // share a core, cluster or package, see PoolLocality. The last entry is for
+  // the thread calling `Run`, which the caller is responsible for pinning.
+  explicit ThreadPool(const std::vector<size_t>& worker_lps)
+      : owner_(worker_lps.size(), WorkerTopology(worker_lps)) {
+    (void)busy_;  // unused in non-debug builds, avoid warning
+    const size_t num_workers = owner_.NumWorkers();
+    HWY_ASSERT(worker_lps.size() == num_workers);
+
+    threads_.reserve(num_workers - 1);
+    for (size_t thread = 0; thread < num_workers - 1; ++thread) {
+      threads_.emplace_back(ThreadFunc, thread, num_workers, worker_lps[thread],
+                            owner_.Mem());
     }
   }
 
@@ -600,8 +1344,10 @@ class ThreadPool {
 
   // `mode` is initially `kBlock`, which means futex. Switching to `kSpin`
   // reduces fork-join overhead especially when there are many calls to `Run`,
-  // but wastes power when waiting over long intervals. Inexpensive, OK to call
-  // multiple times, but not concurrently with any `Run`.
+  // but wastes power when waiting over long intervals. `kAdaptive` spins only
+  // for about as long as recent intervals between `Run`, then blocks.
+  // Inexpensive, OK to call multiple times, but not concurrently with any
+  // `Run`.
   void SetWaitMode(PoolWaitMode mode) {
     // Run must not be active, otherwise we may overwrite the previous command
     // before it is seen by all workers.
@@ -623,15 +1369,36 @@ class ThreadPool {
     HWY_DASSERT(busy_.fetch_add(-1) == 1);
   }
 
+  // Enables or disables concurrent mode, in which `Run` may be called
+  // concurrently from any threads, including from within closures (nested
+  // parallelism). Callers that find the pool busy publish their tasks so that
+  // workers help with them after finishing their own, and themselves help
+  // others while waiting. The `thread` argument to closures is then less than
+  // `NumThreadIndices()`. Not thread-safe: do not call concurrently with `Run`.
+  void SetConcurrent(bool concurrent) {
+    HWY_DASSERT(busy_.load() == 0);
+    concurrent_ = concurrent;
+  }
+
+  // Upper bound on the `thread` argument to closures. Equal to NumWorkers()
+  // unless in concurrent mode, where threads that are not workers but call
+  // `Run` while the pool is busy receive additional indices.
+  size_t NumThreadIndices() const {
+    return NumWorkers() + (concurrent_ ? PoolRegions::kMaxRegions : 0);
+  }
+
   // parallel-for: Runs `closure(task, thread)` on worker thread(s) for every
   // `task` in `[begin, end)`. Note that the unit of work should be large
   // enough to amortize the function call overhead, but small enough that each
   // worker processes a few tasks. Thus each `task` is usually a loop.
   //
   // Not thread-safe - concurrent calls to `Run` in the same ThreadPool are
-  // forbidden unless NumWorkers() == 0. We check for that in debug builds.
+  // forbidden unless NumWorkers() == 0 or `SetConcurrent(true)`. We check for
+  // that in debug builds.
   template <class Closure>
   void Run(uint64_t begin, uint64_t end, const Closure& closure) {
+    if (HWY_UNLIKELY(concurrent_)) return RunConcurrent(begin, end, closure);
+
     const size_t num_workers = NumWorkers();
     PoolMem& mem = *owner_.Mem();
 
@@ -639,20 +1406,201 @@ class ThreadPool {
       // Only check if we are going to fork/join.
       HWY_DASSERT(busy_.fetch_add(1) == 0);
 
-      mem.barrier.Reset();
-      mem.commands.Broadcast(PoolCommands::kWork);
+      ForkJoin(mem, /*help=*/false);
 
-      // Also perform work on main thread instead of busy-waiting.
-      const size_t thread = num_workers - 1;
-      ParallelFor::WorkerRun(thread, num_workers, mem);
-      mem.barrier.WorkerArrive(thread);
+      HWY_DASSERT(busy_.fetch_add(-1) == 1);
+    }
+  }
 
-      mem.barrier.WaitAll(num_workers);
+  // Returns the total number of tasks that workers stole from victims with the
+  // given `locality`, since construction or the last `ResetStats`. Must not be
+  // called concurrently with `Run`.
+  uint64_t NumStolen(PoolLocality locality) const {
+    PoolMem& mem = *owner_.Mem();
+    uint64_t total = 0;
+    for (size_t thread = 0; thread < NumWorkers(); ++thread) {
+      total += mem.Worker(thread).NumStolen(locality);
+    }
+    return total;
+  }
+
+  // Returns statistics of worker `thread`, which are only collected in
+  // `PoolWaitMode::kAdaptive`. The main thread (NumWorkers() - 1) never waits.
+  // Must not be called concurrently with `Run`.
+  const PoolWaitStats& WaitStats(size_t thread) const {
+    HWY_DASSERT(thread < NumWorkers());
+    return owner_.Mem()->Worker(thread).WaitStats();
+  }
+
+  void ResetStats() {
+    PoolMem& mem = *owner_.Mem();
+    for (size_t thread = 0; thread < NumWorkers(); ++thread) {
+      mem.Worker(thread).ResetStats();
+    }
+  }
+
+  // Runs `closure(range_begin, range_end, thread)` for disjoint subranges
+  // ("chunks") that together cover `[begin, end)`. Each has `grain` tasks,
+  // except possibly the last. If `grain` is zero, a size is chosen such that
+  // each worker initially receives several chunks. Compared to `Run`, this
+  // amortizes the scheduling and call overhead when tasks are cheap, and
+  // workers that run out of chunks steal half of a victim's remaining chunks.
+  // Same thread-safety as `Run`.
+  template <class Closure>
+  void RunChunks(uint64_t begin, uint64_t end, uint64_t grain,
+                 const Closure& closure) {
+    const size_t num_workers = NumWorkers();
+    if (HWY_UNLIKELY(concurrent_)) {
+      // Concurrent callers cannot modify the per-worker state, hence run each
+      // chunk as a single task.
+      HWY_DASSERT(begin <= end);
+      grain = ParallelFor::ChunkSize(end - begin, grain, num_workers);
+      return RunConcurrent(0, DivCeil(end - begin, grain),
+                           [&](uint64_t chunk, size_t thread) {
+                             const uint64_t task = begin + chunk * grain;
+                             closure(task, HWY_MIN(task + grain, end), thread);
+                           });
+    }
+
+    PoolMem& mem = *owner_.Mem();
+    if (HWY_LIKELY(ParallelFor::PlanChunks(begin, end, grain, num_workers,
+                                           closure, mem))) {
+      HWY_DASSERT(busy_.fetch_add(1) == 0);
+
+      ForkJoin(mem, /*help=*/false);
 
       HWY_DASSERT(busy_.fetch_add(-1) == 1);
     }
   }
 
+  // Returns the `thread` that `RunStatic(begin, end, ..)` passes to its
+  // closure for `task`.
+  size_t StaticThread(uint64_t begin, uint64_t end, uint64_t task) const {
+    HWY_DASSERT(begin <= task && task < end);
+    return ParallelFor::StaticThread(task - begin, end - begin, NumWorkers());
+  }
+
+  // Runs `closure(task, thread)` for each `task` in `[begin, end)`, where
+  // `thread` is always `StaticThread(begin, end, task)`: each worker receives
+  // a contiguous range of tasks, in order of `thread`, and runs them in
+  // ascending order. Unlike `Run`, the assignment is thus the same in every
+  // call with the same arguments, which enables bitwise reproducible
+  // per-thread accumulators and reuse of data cached by the previous call, at
+  // the cost of imbalance if tasks differ in cost. If `steal_if_idle`, workers
+  // that finish early take over the upper half of the remaining tasks of
+  // others, hence the assignment then only holds if tasks are balanced.
+  // In concurrent mode, waits until no other `Run` is active. If called from
+  // within a closure of this pool in concurrent mode, runs all tasks serially
+  // on the calling thread.
+  template <class Closure>
+  void RunStatic(uint64_t begin, uint64_t end, const Closure& closure,
+                 bool steal_if_idle = false) {
+    PoolMem& mem = *owner_.Mem();
+    const bool concurrent = concurrent_;
+    PoolThreadContext& context = CurrentPoolThread();
+    const PoolThreadContext prev_context = context;
+    if (HWY_UNLIKELY(concurrent)) {
+      if (prev_context.mem == &mem) {
+        for (uint64_t task = begin; task < end; ++task) {
+          closure(task, prev_context.thread);
+        }
+        return;
+      }
+      int expected = 0;
+      while (!busy_.compare_exchange_weak(expected, 1,
+                                          std::memory_order_acquire)) {
+        expected = 0;
+        hwy::Pause();
+      }
+      context.mem = &mem;
+      context.thread = NumWorkers() - 1;
+    } else {
+      HWY_DASSERT(busy_.fetch_add(1) == 0);
+    }
+
+    const size_t num_workers = NumWorkers();
+    if (steal_if_idle) {
+      // Chunks of one task are assigned as in Plan, and thieves take the
+      // upper half of the remaining chunks.
+      const auto run_range = [&closure](uint64_t range_begin,
+                                        uint64_t range_end, size_t thread) {
+        for (uint64_t task = range_begin; task < range_end; ++task) {
+          closure(task, thread);
+        }
+      };
+      if (ParallelFor::PlanChunks(begin, end, /*grain=*/1, num_workers,
+                                  run_range, mem)) {
+        ForkJoin(mem, /*help=*/concurrent);
+      }
+    } else if (ParallelFor::Plan(begin, end, num_workers, closure, mem,
+                                 /*no_steal=*/true)) {
+      ForkJoin(mem, /*help=*/concurrent);
+    }
+
+    if (HWY_UNLIKELY(concurrent)) {
+      context = prev_context;
+      busy_.store(0, std::memory_order_release);
+    } else {
+      HWY_DASSERT(busy_.fetch_add(-1) == 1);
+    }
+  }
+
+  // Returns zero-initialized memory intended for use by worker `thread`, e.g.
+  // its scratch buffers. To place the pages on the NUMA node of that worker,
+  // it touches them first. Because pages may have been touched before, e.g.
+  // when the allocator reuses them, it also requests their migration via
+  // `BindMemoryToNode`, if available. This is only helpful if the workers are
+  // pinned, see the `worker_lps` constructor. The calling thread is worker
+  // `NumWorkers() - 1`. Must not be called from within a `Run` closure, nor
+  // concurrently with `Run` unless in concurrent mode.
+  AlignedFreeUniquePtr<uint8_t[]> AllocateForWorker(size_t thread,
+                                                    size_t bytes) {
+    HWY_DASSERT(thread < NumWorkers());
+    AlignedFreeUniquePtr<uint8_t[]> ptr = AllocateAligned<uint8_t>(bytes);
+    if (!ptr) return ptr;
+    uint8_t* bytes_ptr = ptr.get();
+    const auto touch = [bytes_ptr, bytes]() {
+      const size_t node = CurrentNode();
+      if (node != kUnknownNode) {
+        (void)BindMemoryToNode(bytes_ptr, bytes, node);
+      }
+      ZeroBytes(bytes_ptr, bytes);
+    };
+    if (thread == NumWorkers() - 1) {
+      touch();
+    } else {
+      RunOnWorker(thread, touch);
+    }
+    return ptr;
+  }
+
+  // Starts `num_job_threads` threads that run closures passed to `Submit`.
+  // These are in addition to the workers, which remain available for `Run`.
+  // Must be called at most once, and before any `Submit`.
+  void StartJobThreads(size_t num_job_threads = 1) {
+    HWY_ASSERT(!jobs_);
+    if (num_job_threads == 0) return;
+    jobs_ = MakeUniqueAligned<PoolJobs>(num_job_threads);
+  }
+
+  // Returns the number of threads started by `StartJobThreads`.
+  size_t NumJobThreads() const { return jobs_ ? jobs_->NumThreads() : 0; }
+
+  // Asynchronously runs `closure()` on a job thread and returns a handle for
+  // `IsDone` and `Wait`. The closure is copied into a preallocated slot and
+  // must not exceed `PoolJobs::kMaxClosureBytes`. Runs `closure` on the
+  // calling thread if there are no job threads or too many pending jobs.
+  // Thread-safe, and may be called concurrently with `Run`. Pending jobs
+  // finish before the pool is destroyed.
+  template <class Closure>
+  PoolJobHandle Submit(const Closure& closure) {
+    if (HWY_UNLIKELY(!jobs_)) {
+      closure();
+      return PoolJobHandle();
+    }
+    return jobs_->Submit(closure);
+  }
+
   // Can pass this as init_closure when no initialization is needed.
   // DEPRECATED, better to call the Run() overload without the init_closure arg.
   static bool NoInit(size_t /*num_threads*/) { return true; }  // DEPRECATED
@@ -677,6 +1625,128 @@ class ThreadPool {
   PoolMem& InternalMem() const { return *owner_.Mem(); }
 
  private:
+  // Wakes workers, runs tasks on the main thread, then waits for the workers.
+  // Requires a prior successful Plan. If `help`, the main thread also helps
+  // concurrent regions while waiting.
+  HWY_INLINE void ForkJoin(PoolMem& mem, bool help) {
+    const size_t num_workers = NumWorkers();
+    // Main thread's wait mode is always the same as the workers'.
+    const size_t thread = num_workers - 1;
+    const bool adaptive =
+        mem.Worker(thread).WorkerGetWaitMode() == PoolWaitMode::kAdaptive;
+    if (adaptive) UpdateSpinBudget(mem);
+
+    mem.barrier.Reset();
+    mem.commands.Broadcast(PoolCommands::kWork);
+
+    // Also perform work on main thread instead of busy-waiting.
+    ParallelFor::WorkerRun(thread, num_workers, mem);
+    mem.barrier.WorkerArrive(thread);
+
+    if (help) {
+      while (!mem.barrier.AllArrived(num_workers)) {
+        if (!mem.regions.Help(thread)) hwy::Pause();
+      }
+    } else {
+      mem.barrier.WaitAll(num_workers);
+    }
+    if (adaptive) prev_run_end_ = platform::Now();
+  }
+
+  template <class Closure>
+  void RunConcurrent(uint64_t begin, uint64_t end, const Closure& closure) {
+    PoolMem& mem = *owner_.Mem();
+    PoolThreadContext& context = CurrentPoolThread();
+    const PoolThreadContext prev_context = context;
+
+    // If the pool is idle, claim it and use the usual fork-join.
+    int expected = 0;
+    if (busy_.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+      context.mem = &mem;
+      context.thread = NumWorkers() - 1;
+      if (ParallelFor::Plan(begin, end, NumWorkers(), closure, mem)) {
+        ForkJoin(mem, /*help=*/true);
+      }
+      context = prev_context;
+      busy_.store(0, std::memory_order_release);
+      return;
+    }
+
+    if (begin >= end) return;
+    PoolRegion region(closure, begin, end);
+    // Our own workers, or the thread currently running ForkJoin, already have
+    // an index. Other threads use one derived from their slot, hence they must
+    // wait for a slot.
+    const bool is_member = prev_context.mem == &mem;
+    size_t slot;
+    for (;;) {
+      slot = mem.regions.Publish(&region);
+      if (slot != PoolRegions::kMaxRegions || is_member) break;
+      hwy::Pause();
+    }
+    const size_t thread = is_member ? prev_context.thread : NumWorkers() + slot;
+
+    // All slots occupied: run serially.
+    if (slot == PoolRegions::kMaxRegions) {
+      for (uint64_t task = begin; task < end; ++task) {
+        closure(task, thread);
+      }
+      return;
+    }
+
+    context.mem = &mem;
+    context.thread = thread;
+    while (region.RunOne(thread)) {
+    }
+    // Others may still be running our tasks; help them or other regions.
+    while (!region.IsDone()) {
+      if (!mem.regions.Help(thread)) hwy::Pause();
+    }
+    mem.regions.Unpublish(slot);
+    context = prev_context;
+  }
+
+  // Calls `closure()` on worker `thread`.
+  template <class Closure>
+  void RunOnWorker(size_t thread, const Closure& closure) {
+    RunStatic(0, NumWorkers(), [thread, &closure](uint64_t task, size_t t) {
+      HWY_DASSERT(task == t);
+      (void)task;
+      if (t == thread) closure();
+    });
+  }
+
+  // Spinning longer than this is unlikely to be cheaper than a futex wake.
+  static constexpr double kMaxSpinSeconds = 100E-6;
+
+  // Calibrates the kAdaptive spin budget from an exponential moving average of
+  // the intervals between `Run`, which are clamped so that a single long idle
+  // period does not cause a long spin after the next burst.
+  void UpdateSpinBudget(PoolMem& mem) {
+    const double now = platform::Now();
+    if (prev_run_end_ != 0.0) {
+      const double interval = HWY_MIN(now - prev_run_end_, kMaxSpinSeconds);
+      interval_ema_ += (HWY_MAX(interval, 0.0) - interval_ema_) * 0.125;
+    }
+    // Allow for some variation of the intervals.
+    const double budget = HWY_MIN(2.0 * interval_ema_, kMaxSpinSeconds);
+    mem.commands.SetSpinBudget(now, budget);
+  }
+
+  // Returns the Topology::LP of each worker, or an empty vector if unknown.
+  static std::vector<Topology::LP> WorkerTopology(
+      const std::vector<size_t>& worker_lps) {
+    std::vector<Topology::LP> lps;
+    const Topology topology;
+    if (topology.packages.empty()) return lps;
+    lps.reserve(worker_lps.size());
+    for (size_t lp : worker_lps) {
+      if (lp >= topology.lps.size()) return std::vector<Topology::LP>();
+      lps.push_back(topology.lps[lp]);
+    }
+    return lps;
+  }
+
   // Unmodified after ctor, but cannot be const because we call thread::join().
   std::vector<std::thread> threads_;
 
@@ -685,6 +1755,230 @@ class ThreadPool {
   // In debug builds, detects if functions are re-entered; always present so
   // that the memory layout does not change.
   std::atomic<int> busy_{0};
+
+  // For kAdaptive; only accessed by the thread calling `Run`.
+  double prev_run_end_ = 0.0;
+  double interval_ema_ = 0.0;
+
+  bool concurrent_ = false;
+
+  // Created by StartJobThreads.
+  AlignedUniquePtr<PoolJobs> jobs_;
+};
+
+// Returns `combine` of `identity` and `map(task)` for all tasks in
+// `[begin, end)`. Each worker accumulates into its own partial result, which
+// is padded to avoid false sharing, and the partial results are then combined
+// in a tree ordered by worker index. `combine` must be associative, and
+// `identity` must be its identity element. If `deterministic`, tasks are
+// assigned as in `ThreadPool::RunStatic` and each partial result combines its
+// tasks in ascending order, hence float sums are bitwise reproducible for the
+// same `NumWorkers()`. Otherwise, uses work stealing, which is better suited
+// for tasks of differing cost.
+template <typename T, class MapFunc, class CombineFunc>
+T ParallelReduce(ThreadPool& pool, uint64_t begin, uint64_t end,
+                 const T& identity, const MapFunc& map,
+                 const CombineFunc& combine, bool deterministic = false) {
+  struct alignas(HWY_ALIGNMENT) Partial {
+    explicit Partial(const T& identity) : value(identity) {}
+    T value;
+  };
+
+  // Concurrent mode may use indices beyond NumWorkers().
+  const size_t num_partials = pool.NumThreadIndices();
+  AlignedUniquePtr<Partial[]> partials =
+      MakeUniqueAlignedArray<Partial>(num_partials, identity);
+  HWY_ASSERT(partials);
+
+  const auto accumulate = [&](uint64_t task, size_t thread) {
+    T& partial = partials[thread].value;
+    partial = combine(partial, map(task));
+  };
+  if (deterministic) {
+    pool.RunStatic(begin, end, accumulate);
+  } else {
+    pool.Run(begin, end, accumulate);
+  }
+
+  // Pairwise combination has a fixed order and shorter dependency chains
+  // than a linear scan. Serial because there are at most dozens of partials.
+  for (size_t stride = 1; stride < num_partials; stride *= 2) {
+    for (size_t i = 0; i + stride < num_partials; i += 2 * stride) {
+      partials[i].value =
+          combine(partials[i].value, partials[i + stride].value);
+    }
+  }
+  return partials[0].value;
+}
+
+// Hierarchy of ThreadPool, one per package, cluster (e.g. CCX/shared L3) and
+// the logical processors (LPs) within a cluster. All threads are pinned to
+// their LP, which prevents migrations across clusters and packages. The main
+// thread participates in (and is pinned to an LP of) the last cluster of the
+// last package.
+//
+// The outer pool has one worker per package, each of which is the main thread
+// of a package pool with one worker per cluster, each of which is in turn the
+// main thread of a cluster pool with one worker per LP. Hence the total number
+// of threads equals the number of LPs, and `Run` only involves pools whose
+// workers share a cache.
+class NestedPools {
+ public:
+  // `max_threads` = 0 means no limit, otherwise clusters are used in order
+  // until reaching that many workers. If `pin`, threads (including the caller)
+  // are pinned to their LP. Falls back to a single package and cluster if the
+  // topology is unknown, in which case there is no pinning.
+  explicit NestedPools(size_t max_threads = 0, bool pin = true) {
+    LogicalProcessorSet enabled;
+    const bool have_affinity = GetThreadAffinity(enabled);
+    const Topology topology;
+
+    if (have_affinity && !topology.packages.empty()) {
+      for (const Topology::Package& tpkg : topology.packages) {
+        PackageState pkg;
+        for (const Topology::Cluster& tcluster : tpkg.clusters) {
+          std::vector<size_t> cluster_lps;
+          tcluster.lps.Foreach([&](size_t lp) {
+            if (!enabled.Get(lp)) return;
+            if (max_threads != 0 && num_workers_ >= max_threads) return;
+            cluster_lps.push_back(lp);
+            ++num_workers_;
+          });
+          if (!cluster_lps.empty()) pkg.cluster_lps.push_back(cluster_lps);
+        }
+        if (!pkg.cluster_lps.empty()) packages_.push_back(std::move(pkg));
+      }
+    }
+
+    // Unknown topology: one package with one cluster, without pinning.
+    if (packages_.empty()) {
+      pin = false;
+      size_t num_lps = ThreadPool::MaxThreads() + 1;
+      if (max_threads != 0) num_lps = HWY_MIN(num_lps, max_threads);
+      num_lps = HWY_MAX(num_lps, size_t{1});
+      PackageState pkg;
+      pkg.cluster_lps.push_back(std::vector<size_t>(num_lps, 0));
+      packages_.push_back(std::move(pkg));
+      num_workers_ = num_lps;
+    }
+
+    // Create pools; each worker has a unique index across all clusters.
+    size_t worker_offset = 0;
+    for (PackageState& pkg : packages_) {
+      pkg.pool = MakeUniqueAligned<ThreadPool>(pkg.cluster_lps.size());
+      for (const std::vector<size_t>& cluster_lps : pkg.cluster_lps) {
+        pkg.clusters.push_back(
+            pin ? MakeUniqueAligned<ThreadPool>(cluster_lps)
+                : MakeUniqueAligned<ThreadPool>(cluster_lps.size()));
+        pkg.worker_offsets.push_back(worker_offset);
+        worker_offset += cluster_lps.size();
+      }
+    }
+    HWY_DASSERT(worker_offset == num_workers_);
+    outer_pool_ = MakeUniqueAligned<ThreadPool>(packages_.size());
+
+    if (pin) PinMainThreads();
+  }
+
+  NestedPools(const NestedPools&) = delete;
+  NestedPools& operator=(const NestedPools&) = delete;
+
+  // Total number of workers across all clusters, i.e., one more than the
+  // largest `thread` argument passed to `Run` closures.
+  size_t NumWorkers() const { return num_workers_; }
+  size_t NumPackages() const { return packages_.size(); }
+  size_t NumClusters(size_t package) const {
+    return packages_[package].clusters.size();
+  }
+
+  // One worker per package.
+  ThreadPool& AllPackages() { return *outer_pool_; }
+  // One worker per cluster within `package`.
+  ThreadPool& Package(size_t package) { return *packages_[package].pool; }
+  // One worker per LP within `cluster` of `package`.
+  ThreadPool& Cluster(size_t package, size_t cluster) {
+    return *packages_[package].clusters[cluster];
+  }
+
+  // Index of worker 0 of `Cluster(package, cluster)` within [0, NumWorkers()).
+  size_t WorkerOffset(size_t package, size_t cluster) const {
+    return packages_[package].worker_offsets[cluster];
+  }
+
+  // Sets all wait modes, see ThreadPool::SetWaitMode.
+  void SetWaitMode(PoolWaitMode mode) {
+    outer_pool_->SetWaitMode(mode);
+    for (PackageState& pkg : packages_) {
+      pkg.pool->SetWaitMode(mode);
+      for (const AlignedUniquePtr<ThreadPool>& cluster : pkg.clusters) {
+        cluster->SetWaitMode(mode);
+      }
+    }
+  }
+
+  // Runs `closure(task, thread)` for every `task` in `[begin, end)`, where
+  // `thread` < NumWorkers(). Tasks are handed out outer-to-inner: each package
+  // and then each cluster receives a contiguous subrange whose size is
+  // proportional to its number of workers. Work stealing only happens within a
+  // cluster, so consecutive tasks tend to share an L3. Same restrictions as
+  // ThreadPool::Run regarding concurrent calls.
+  template <class Closure>
+  void Run(uint64_t begin, uint64_t end, const Closure& closure) {
+    HWY_DASSERT(begin <= end);
+    const uint64_t num_tasks = end - begin;
+    if (HWY_UNLIKELY(num_tasks == 0)) return;
+
+    // num_tasks == NumWorkers, so each package/cluster is a separate worker.
+    outer_pool_->Run(0, packages_.size(), [&](uint64_t ip, size_t /*thread*/) {
+      PackageState& pkg = packages_[ip];
+      pkg.pool->Run(0, pkg.clusters.size(), [&](uint64_t ic, size_t) {
+        const size_t offset = pkg.worker_offsets[ic];
+        ThreadPool& cluster = *pkg.clusters[ic];
+        const uint64_t cluster_begin = begin + Share(num_tasks, offset);
+        const uint64_t cluster_end =
+            begin + Share(num_tasks, offset + cluster.NumWorkers());
+        cluster.Run(cluster_begin, cluster_end,
+                    [&](uint64_t task, size_t thread) {
+                      closure(task, offset + thread);
+                    });
+      });
+    });
+  }
+
+ private:
+  struct PackageState {
+    // LPs for each cluster; only used in the ctor.
+    std::vector<std::vector<size_t>> cluster_lps;
+    AlignedUniquePtr<ThreadPool> pool;
+    std::vector<AlignedUniquePtr<ThreadPool>> clusters;
+    std::vector<size_t> worker_offsets;  // one per cluster
+  };
+
+  // Returns floor(num_tasks * workers / NumWorkers()) without overflow.
+  uint64_t Share(uint64_t num_tasks, size_t workers) const {
+    const uint64_t quotient = num_tasks / num_workers_;
+    const uint64_t remainder = num_tasks % num_workers_;
+    return quotient * workers + remainder * workers / num_workers_;
+  }
+
+  // Cluster pools pin their own workers except the thread calling their `Run`,
+  // which we pin here. This relies on Run with NumWorkers() tasks assigning
+  // task i to thread i.
+  void PinMainThreads() {
+    outer_pool_->Run(0, packages_.size(), [this](uint64_t ip, size_t) {
+      PackageState& pkg = packages_[ip];
+      pkg.pool->Run(0, pkg.clusters.size(), [&pkg](uint64_t ic, size_t) {
+        const size_t lp = pkg.cluster_lps[ic].back();
+        if (HWY_UNLIKELY(!PinThreadToLogicalProcessor(lp))) {
+          fprintf(stderr, "Pinning failed for LP %zu\n", lp);
+        }
+      });
+    });
+  }
+
+  size_t num_workers_ = 0;
+  std::vector<PackageState> packages_;
+  AlignedUniquePtr<ThreadPool> outer_pool_;
 };
 
 }  // namespace hwy
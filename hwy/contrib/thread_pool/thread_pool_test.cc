@@ -25,6 +25,7 @@
 #include <stdio.h>
 
 #include <atomic>
+#include <thread>  // NOLINT
 #include <vector>
 
 #include "hwy/base.h"  // PopCount
@@ -237,6 +238,136 @@ TEST(ThreadPoolTest, TestTasks) {
   }
 }
 
+// Ensures victims are ordered by increasing locality.
+TEST(ThreadPoolTest, TestVictimLocality) {
+  // Two packages, each with two clusters of two cores with two SMT.
+  constexpr size_t kNumWorkers = 16;
+  std::vector<Topology::LP> lps(kNumWorkers);
+  for (size_t i = 0; i < kNumWorkers; ++i) {
+    lps[i].package = static_cast<uint8_t>(i / 8);
+    lps[i].cluster = static_cast<uint16_t>((i % 8) / 4);
+    lps[i].core = static_cast<uint16_t>((i % 8) / 2);
+    lps[i].smt = static_cast<uint8_t>(i % 2);
+  }
+
+  PoolMemOwner owner(kNumWorkers, lps);
+  PoolMem& mem = *owner.Mem();
+  for (size_t thread = 0; thread < kNumWorkers; ++thread) {
+    const PoolWorker& worker = mem.Worker(thread);
+    // Multiple packages: each worker is on its own pages.
+    HWY_ASSERT(IsAligned(&worker, PageBytes()));
+    const hwy::Span<const uint32_t> victims = worker.Victims();
+    HWY_ASSERT(victims.size() == 4);
+    HWY_ASSERT(victims[0] == thread);
+    // SMT sibling is first, then the other core in the same cluster.
+    HWY_ASSERT(victims[1] == (thread ^ 1));
+    HWY_ASSERT(worker.VictimLocality(1) == PoolLocality::kCore);
+    for (size_t i = 2; i < victims.size(); ++i) {
+      HWY_ASSERT(victims[i] != thread);
+      HWY_ASSERT(victims[i] / 4 == thread / 4);
+      HWY_ASSERT(worker.VictimLocality(i) == PoolLocality::kCluster);
+      HWY_ASSERT(LocalityOf(lps[thread], lps[victims[i]]) ==
+                 PoolLocality::kCluster);
+    }
+  }
+
+  // Without LPs, localities are unknown.
+  PoolMemOwner owner2(kNumWorkers);
+  for (size_t thread = 0; thread < kNumWorkers; ++thread) {
+    const PoolWorker& worker = owner2.Mem()->Worker(thread);
+    HWY_ASSERT(!owner2.Mem()->WorkerBindToNode(thread));
+    for (size_t i = 1; i < worker.Victims().size(); ++i) {
+      HWY_ASSERT(worker.VictimLocality(i) == PoolLocality::kUnknown);
+    }
+  }
+}
+
+// Ensures the steal counters add up to the number of tasks not run by their
+// original worker.
+TEST(ThreadPoolTest, TestStealCounts) {
+  constexpr size_t kNumWorkers = 4;
+  PoolMemOwner owner(kNumWorkers);
+  PoolMem& mem = *owner.Mem();
+
+  // Only the last worker runs, hence it steals all others' tasks.
+  const uint64_t kNumTasks = 100;
+  uint64_t sum = 0;
+  const auto func = [&sum](uint64_t task, size_t /*thread*/) { sum += task; };
+  HWY_ASSERT(ParallelFor::Plan(0, kNumTasks, kNumWorkers, func, mem));
+  ParallelFor::WorkerRun(kNumWorkers - 1, kNumWorkers, mem);
+  HWY_ASSERT_EQ(kNumTasks * (kNumTasks - 1) / 2, sum);
+
+  PoolWorker& worker = mem.Worker(kNumWorkers - 1);
+  HWY_ASSERT_EQ(kNumTasks * 3 / 4, worker.NumStolen(PoolLocality::kUnknown));
+  worker.ResetStats();
+  HWY_ASSERT_EQ(uint64_t{0}, worker.NumStolen(PoolLocality::kUnknown));
+}
+
+// Ensures all tasks are run exactly once and chunks respect the grain size.
+TEST(ThreadPoolTest, TestChunks) {
+  for (size_t num_threads = 0; num_threads <= 8; ++num_threads) {
+    PoolMemOwner owner(num_threads);
+    PoolMem& mem = *owner.Mem();
+    const size_t num_workers = owner.NumWorkers();
+
+    constexpr uint64_t kMaxTasks = 40;
+    uint32_t counts[kMaxTasks];
+    for (uint64_t grain : {0u, 1u, 3u, 7u}) {
+      for (uint64_t num_tasks = 0; num_tasks < kMaxTasks; ++num_tasks) {
+        const uint64_t begin = 3;
+        const uint64_t end = begin + num_tasks;
+        ZeroBytes(counts, sizeof(counts));
+        const auto func = [&](uint64_t range_begin, uint64_t range_end,
+                              size_t /*thread*/) {
+          HWY_ASSERT(begin <= range_begin && range_begin < range_end &&
+                     range_end <= end);
+          if (grain != 0) HWY_ASSERT(range_end - range_begin <= grain);
+          for (uint64_t task = range_begin; task < range_end; ++task) {
+            ++counts[task - begin];
+          }
+        };
+
+        if (ParallelFor::PlanChunks(begin, end, grain, num_workers, func,
+                                    mem)) {
+          // The first worker steals everything, the others find nothing.
+          for (size_t thread = 0; thread < num_workers; ++thread) {
+            ParallelFor::WorkerRun(thread, num_workers, mem);
+          }
+        }
+
+        for (uint64_t i = 0; i < kMaxTasks; ++i) {
+          HWY_ASSERT_EQ(static_cast<uint32_t>(i < num_tasks), counts[i]);
+        }
+      }
+    }
+  }
+}
+
+TEST(ThreadPoolTest, TestRunChunks) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(6);
+  const uint64_t kNumTasks = 100000;
+  for (uint64_t grain : {0u, 1u, 16u, 1000u}) {
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> num_calls{0};
+    pool.RunChunks(0, kNumTasks, grain,
+                   [&](uint64_t begin, uint64_t end, size_t thread) {
+                     HWY_ASSERT(thread < pool.NumWorkers());
+                     uint64_t my_sum = 0;
+                     for (uint64_t task = begin; task < end; ++task) {
+                       my_sum += task;
+                     }
+                     sum.fetch_add(my_sum);
+                     num_calls.fetch_add(1);
+                   });
+    HWY_ASSERT_EQ(kNumTasks * (kNumTasks - 1) / 2, sum.load());
+    if (grain != 0) {
+      HWY_ASSERT_EQ(DivCeil(kNumTasks, grain), num_calls.load());
+    }
+  }
+}
+
 // Ensures old code with 32-bit tasks and InitClosure still compiles.
 TEST(ThreadPoolTest, TestDeprecated) {
   ThreadPool pool(0);
@@ -362,9 +493,40 @@ TEST(ThreadPoolTest, TestWaitMode) {
   ThreadPool pool(kNumThreads);
   RandomState rng;
   for (size_t i = 0; i < 10; ++i) {
-    pool.SetWaitMode(Random32(&rng) ? PoolWaitMode::kSpin
-                                    : PoolWaitMode::kBlock);
+    pool.SetWaitMode(static_cast<PoolWaitMode>(Random32(&rng) % 3));
+  }
+}
+
+// Adaptive mode collects wait statistics for all workers except main.
+TEST(ThreadPoolTest, TestAdaptiveStats) {
+  if (!HaveThreadingSupport()) return;
+
+  const size_t kNumThreads = 4;
+  ThreadPool pool(kNumThreads);
+  pool.SetWaitMode(PoolWaitMode::kAdaptive);
+  pool.ResetStats();
+
+  const size_t kNumRuns = 200;
+  std::atomic<uint64_t> num_tasks{0};
+  for (size_t rep = 0; rep < kNumRuns; ++rep) {
+    pool.Run(0, kNumThreads * 2, [&num_tasks](uint64_t /*task*/, size_t) {
+      num_tasks.fetch_add(1);
+    });
   }
+  HWY_ASSERT_EQ(uint64_t{kNumRuns * kNumThreads * 2}, num_tasks.load());
+
+  for (size_t thread = 0; thread < kNumThreads - 1; ++thread) {
+    const PoolWaitStats& stats = pool.WaitStats(thread);
+    // Workers wake for every Run, but may still be busy with the previous one.
+    HWY_ASSERT(stats.num_wakes <= kNumRuns);
+    HWY_ASSERT(stats.num_blocked <= stats.num_wakes);
+    if (stats.num_blocked == 0) HWY_ASSERT(stats.spin_wasted_ns == 0);
+  }
+  // The main thread never waits for commands.
+  HWY_ASSERT_EQ(uint64_t{0}, pool.WaitStats(kNumThreads - 1).num_wakes);
+
+  pool.ResetStats();
+  HWY_ASSERT_EQ(uint64_t{0}, pool.WaitStats(0).num_wakes);
 }
 
 TEST(ThreadPoolTest, TestCounter) {
@@ -372,8 +534,10 @@ TEST(ThreadPoolTest, TestCounter) {
 
   const size_t kNumThreads = 12;
   ThreadPool pool(kNumThreads);
-  for (PoolWaitMode mode : {PoolWaitMode::kSpin, PoolWaitMode::kBlock}) {
+  for (PoolWaitMode mode : {PoolWaitMode::kSpin, PoolWaitMode::kBlock,
+                            PoolWaitMode::kAdaptive}) {
     pool.SetWaitMode(mode);
+    pool.ResetStats();
     alignas(128) Counter counters[kNumThreads];
 
     const uint64_t kNumTasks = kNumThreads * 19;
@@ -391,6 +555,294 @@ TEST(ThreadPoolTest, TestCounter) {
       counters[0].Assimilate(counters[i]);
     }
     HWY_ASSERT_EQ(expected, counters[0].counter.load());
+
+    // Unpinned pool: all steals have unknown locality.
+    HWY_ASSERT(pool.NumStolen(PoolLocality::kUnknown) <= kNumTasks);
+    HWY_ASSERT_EQ(uint64_t{0}, pool.NumStolen(PoolLocality::kCore));
+  }
+}
+
+// Ensures each task runs exactly once and `thread` is within bounds.
+TEST(ThreadPoolTest, TestNestedPools) {
+  if (!HaveThreadingSupport()) return;
+
+  // NestedPools also pins the main thread; restore its affinity afterwards so
+  // that MaxThreads() in subsequent tests is unaffected.
+  LogicalProcessorSet prev_lps;
+  const bool have_affinity = GetThreadAffinity(prev_lps);
+
+  for (size_t max_threads : {size_t{1}, size_t{3}, size_t{0}}) {
+    NestedPools pools(max_threads);
+    HWY_ASSERT(pools.NumWorkers() != 0);
+    HWY_ASSERT(pools.NumPackages() != 0);
+    if (max_threads != 0) HWY_ASSERT(pools.NumWorkers() <= max_threads);
+
+    size_t num_workers = 0;
+    for (size_t ip = 0; ip < pools.NumPackages(); ++ip) {
+      HWY_ASSERT(pools.Package(ip).NumWorkers() == pools.NumClusters(ip));
+      for (size_t ic = 0; ic < pools.NumClusters(ip); ++ic) {
+        HWY_ASSERT(pools.WorkerOffset(ip, ic) == num_workers);
+        num_workers += pools.Cluster(ip, ic).NumWorkers();
+      }
+    }
+    HWY_ASSERT(num_workers == pools.NumWorkers());
+
+    for (PoolWaitMode mode : {PoolWaitMode::kSpin, PoolWaitMode::kBlock}) {
+      pools.SetWaitMode(mode);
+      constexpr uint64_t kMaxTasks = 100;
+      std::atomic<uint64_t> counts[kMaxTasks];
+      for (uint64_t num_tasks : {0u, 1u, 2u, 7u, 64u, 100u}) {
+        for (size_t i = 0; i < kMaxTasks; ++i) counts[i].store(0);
+        const uint64_t begin = 5;
+        pools.Run(begin, begin + num_tasks,
+                  [&counts, &pools](uint64_t task, size_t thread) {
+                    HWY_ASSERT(thread < pools.NumWorkers());
+                    counts[task - 5].fetch_add(1);
+                  });
+        for (uint64_t i = 0; i < kMaxTasks; ++i) {
+          HWY_ASSERT_EQ(static_cast<uint64_t>(i < num_tasks), counts[i].load());
+        }
+      }
+    }
+  }
+
+  if (have_affinity) HWY_ASSERT(SetThreadAffinity(prev_lps));
+}
+
+// Closures may call Run on the same pool in concurrent mode.
+TEST(ThreadPoolTest, TestNested) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(4);
+  pool.SetConcurrent(true);
+  const size_t num_indices = pool.NumThreadIndices();
+  HWY_ASSERT(num_indices > pool.NumWorkers());
+
+  constexpr size_t kOuter = 8;
+  constexpr size_t kInner = 16;
+  std::atomic<uint32_t> counts[kOuter][kInner];
+  for (size_t rep = 0; rep < AdjustedReps(20); ++rep) {
+    for (size_t i = 0; i < kOuter; ++i) {
+      for (size_t j = 0; j < kInner; ++j) counts[i][j].store(0);
+    }
+    pool.Run(0, kOuter, [&](uint64_t outer, size_t thread) {
+      HWY_ASSERT(thread < num_indices);
+      pool.Run(0, kInner, [&](uint64_t inner, size_t thread2) {
+        HWY_ASSERT(thread2 < num_indices);
+        counts[outer][inner].fetch_add(1);
+      });
+    });
+    for (size_t i = 0; i < kOuter; ++i) {
+      for (size_t j = 0; j < kInner; ++j) {
+        HWY_ASSERT_EQ(1u, counts[i][j].load());
+      }
+    }
+  }
+}
+
+// Independent threads may submit to the same pool in concurrent mode, and no
+// `thread` index is used by two closures at the same time.
+TEST(ThreadPoolTest, TestConcurrentSubmit) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(3);
+  pool.SetConcurrent(true);
+  const size_t num_indices = pool.NumThreadIndices();
+  std::vector<std::atomic<uint32_t>> in_use(num_indices);
+  for (std::atomic<uint32_t>& flag : in_use) flag.store(0);
+
+  constexpr size_t kSubmitters = 3;
+  constexpr uint64_t kNumTasks = 32;
+  const size_t num_runs = AdjustedReps(50);
+  std::atomic<uint64_t> sums[kSubmitters];
+  std::vector<std::thread> submitters;
+  for (size_t s = 0; s < kSubmitters; ++s) {
+    sums[s].store(0);
+    submitters.emplace_back([&, s]() {
+      for (size_t rep = 0; rep < num_runs; ++rep) {
+        pool.Run(0, kNumTasks, [&](uint64_t task, size_t thread) {
+          HWY_ASSERT(thread < num_indices);
+          HWY_ASSERT(in_use[thread].exchange(1) == 0);
+          sums[s].fetch_add(task);
+          in_use[thread].store(0);
+        });
+      }
+    });
+  }
+  for (std::thread& t : submitters) t.join();
+
+  for (size_t s = 0; s < kSubmitters; ++s) {
+    HWY_ASSERT_EQ(num_runs * kNumTasks * (kNumTasks - 1) / 2, sums[s].load());
+  }
+}
+
+// Submitted jobs run asynchronously, also while the workers are busy with
+// `Run`, and more jobs than ring slots fall back to the calling thread.
+TEST(ThreadPoolTest, TestSubmit) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(2);
+  // Without job threads, closures run on the calling thread.
+  uint64_t inline_sum = 0;
+  const PoolJobHandle inline_job = pool.Submit([&]() { inline_sum += 1; });
+  HWY_ASSERT(inline_job.IsDone());
+  HWY_ASSERT_EQ(uint64_t{1}, inline_sum);
+
+  pool.StartJobThreads(2);
+  HWY_ASSERT_EQ(size_t{2}, pool.NumJobThreads());
+
+  constexpr uint64_t kNumJobs = 3 * PoolJobHandle::kMaxJobs;
+  std::atomic<uint64_t> sum{0};
+  std::atomic<uint64_t>* psum = &sum;
+  std::vector<PoolJobHandle> handles;
+  for (uint64_t i = 0; i < kNumJobs; ++i) {
+    handles.push_back(pool.Submit([psum, i]() { psum->fetch_add(i); }));
+  }
+
+  // Overlap with a fork-join region.
+  std::atomic<uint64_t> run_sum{0};
+  pool.Run(0, 100, [&](uint64_t task, size_t /*thread*/) {
+    run_sum.fetch_add(task);
+  });
+  HWY_ASSERT_EQ(uint64_t{100 * 99 / 2}, run_sum.load());
+
+  for (const PoolJobHandle& handle : handles) {
+    handle.Wait();
+    HWY_ASSERT(handle.IsDone());
+  }
+  HWY_ASSERT_EQ(kNumJobs * (kNumJobs - 1) / 2, sum.load());
+
+  // Concurrent submitters.
+  sum.store(0);
+  std::vector<std::thread> submitters;
+  for (size_t s = 0; s < 3; ++s) {
+    submitters.emplace_back([&]() {
+      std::vector<PoolJobHandle> mine;
+      for (uint64_t i = 0; i < kNumJobs; ++i) {
+        mine.push_back(pool.Submit([psum]() { psum->fetch_add(1); }));
+      }
+      for (const PoolJobHandle& handle : mine) handle.Wait();
+    });
+  }
+  for (std::thread& t : submitters) t.join();
+  HWY_ASSERT_EQ(3 * kNumJobs, sum.load());
+}
+
+// RunStatic always assigns a task to the same thread, in ascending order.
+TEST(ThreadPoolTest, TestRunStatic) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(4);
+  const size_t num_workers = pool.NumWorkers();
+  for (bool concurrent : {false, true}) {
+    pool.SetConcurrent(concurrent);
+    for (uint64_t num_tasks : {0u, 1u, 3u, 4u, 7u, 100u, 1001u}) {
+      const uint64_t begin = 5;
+      const uint64_t end = begin + num_tasks;
+      std::vector<uint64_t> threads(num_tasks);
+      std::vector<uint64_t> prev_task(num_workers, 0);
+      pool.RunStatic(begin, end, [&](uint64_t task, size_t thread) {
+        HWY_ASSERT(begin <= task && task < end);
+        HWY_ASSERT(thread == pool.StaticThread(begin, end, task));
+        // Ascending within each thread.
+        HWY_ASSERT(prev_task[thread] < task);
+        prev_task[thread] = task;
+        threads[task - begin] = thread;
+      });
+      // Contiguous ranges in order of thread, as balanced as possible.
+      std::vector<uint64_t> counts(num_workers, 0);
+      for (uint64_t i = 0; i < num_tasks; ++i) {
+        if (i != 0) HWY_ASSERT(threads[i - 1] <= threads[i]);
+        ++counts[threads[i]];
+      }
+      for (size_t thread = 0; thread < num_workers; ++thread) {
+        HWY_ASSERT(counts[thread] == num_tasks / num_workers ||
+                   counts[thread] == num_tasks / num_workers + 1);
+      }
+
+      // With stealing, each task still runs exactly once.
+      std::vector<std::atomic<uint32_t>> runs(num_tasks);
+      for (std::atomic<uint32_t>& r : runs) r.store(0);
+      pool.RunStatic(
+          begin, end,
+          [&](uint64_t task, size_t thread) {
+            HWY_ASSERT(thread < num_workers);
+            runs[task - begin].fetch_add(1);
+          },
+          /*steal_if_idle=*/true);
+      for (std::atomic<uint32_t>& r : runs) HWY_ASSERT(r.load() == 1);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, TestParallelReduce) {
+  if (!HaveThreadingSupport()) return;
+
+  ThreadPool pool(4);
+  const auto add = [](uint64_t a, uint64_t b) { return a + b; };
+  const auto max = [](uint64_t a, uint64_t b) { return HWY_MAX(a, b); };
+  for (bool deterministic : {false, true}) {
+    for (uint64_t num_tasks : {0u, 1u, 5u, 1000u}) {
+      const uint64_t sum = ParallelReduce(
+          pool, 1, num_tasks + 1, uint64_t{0},
+          [](uint64_t task) { return task; }, add, deterministic);
+      HWY_ASSERT_EQ(num_tasks * (num_tasks + 1) / 2, sum);
+      const uint64_t largest = ParallelReduce(
+          pool, 1, num_tasks + 1, uint64_t{0},
+          [](uint64_t task) { return task * 3 % 1001; }, max, deterministic);
+      uint64_t expected = 0;
+      for (uint64_t task = 1; task <= num_tasks; ++task) {
+        expected = HWY_MAX(expected, task * 3 % 1001);
+      }
+      HWY_ASSERT_EQ(expected, largest);
+    }
+  }
+
+  // Deterministic float sums are bitwise identical across calls, including in
+  // concurrent mode.
+  const auto map = [](uint64_t task) {
+    return 1.0f / static_cast<float>(task * task + 1);
+  };
+  const auto add_float = [](float a, float b) { return a + b; };
+  const float reference =
+      ParallelReduce(pool, 0, 10000, 0.0f, map, add_float, true);
+  HWY_ASSERT(reference > 1.0f);
+  for (bool concurrent : {false, true}) {
+    pool.SetConcurrent(concurrent);
+    for (size_t rep = 0; rep < AdjustedReps(20); ++rep) {
+      const float sum =
+          ParallelReduce(pool, 0, 10000, 0.0f, map, add_float, true);
+      HWY_ASSERT(BitCastScalar<uint32_t>(sum) ==
+                 BitCastScalar<uint32_t>(reference));
+    }
+  }
+}
+
+// AllocateForWorker returns zero-initialized memory for any worker.
+TEST(ThreadPoolTest, TestAllocateForWorker) {
+  if (!HaveThreadingSupport()) return;
+
+  for (size_t num_threads : {0u, 3u}) {
+    ThreadPool pool(num_threads);
+    std::vector<AlignedFreeUniquePtr<uint8_t[]>> buffers;
+    for (size_t thread = 0; thread < pool.NumWorkers(); ++thread) {
+      const size_t bytes = 3 * PageBytes() + 17;
+      buffers.push_back(pool.AllocateForWorker(thread, bytes));
+      HWY_ASSERT(buffers.back());
+      for (size_t i = 0; i < bytes; ++i) {
+        HWY_ASSERT(buffers.back()[i] == 0);
+      }
+    }
+
+    // The pool remains usable, also for concurrent mode.
+    pool.SetConcurrent(true);
+    auto bytes = pool.AllocateForWorker(0, 100);
+    HWY_ASSERT(bytes);
+    std::atomic<uint64_t> sum{0};
+    pool.Run(0, 10, [&](uint64_t task, size_t /*thread*/) {
+      sum.fetch_add(task);
+    });
+    HWY_ASSERT_EQ(uint64_t{45}, sum.load());
   }
 }
 
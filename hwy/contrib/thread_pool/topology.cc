@@ -58,6 +58,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #endif  // HWY_OS_LINUX
 
 #include "hwy/base.h"
@@ -222,6 +223,53 @@ HWY_CONTRIB_DLLEXPORT bool SetThreadAffinity(const LogicalProcessorSet& lps) {
 #endif
 }
 
+HWY_CONTRIB_DLLEXPORT size_t PageBytes() {
+#if HWY_OS_LINUX || HWY_OS_FREEBSD
+  const long bytes = sysconf(_SC_PAGESIZE);
+  if (bytes > 0) return static_cast<size_t>(bytes);
+#endif
+  return 4096;
+}
+
+HWY_CONTRIB_DLLEXPORT size_t CurrentNode() {
+#if HWY_OS_LINUX && defined(SYS_getcpu)
+  unsigned cpu, node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<size_t>(node);
+  }
+#endif
+  return kUnknownNode;
+}
+
+HWY_CONTRIB_DLLEXPORT bool BindMemoryToNode(void* ptr, size_t bytes,
+                                            size_t node) {
+#if HWY_OS_LINUX && defined(SYS_mbind)
+  // From numaif.h, which requires libnuma.
+  constexpr int kPreferred = 1;        // MPOL_PREFERRED
+  constexpr unsigned kMove = 1u << 1;  // MPOL_MF_MOVE
+  constexpr size_t kMaxNodes = 1024;   // matches kMaxLogicalProcessors
+  constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;  // NOLINT
+  if (node >= kMaxNodes) return false;
+
+  const uintptr_t page = static_cast<uintptr_t>(PageBytes());
+  const uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+  const uintptr_t begin = (addr + page - 1) & ~(page - 1);
+  const uintptr_t end = (addr + bytes) & ~(page - 1);
+  if (begin >= end) return false;
+
+  unsigned long mask[kMaxNodes / kBitsPerWord] = {};  // NOLINT
+  mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  // The kernel ignores the last bit of `maxnode`, hence +1.
+  return syscall(SYS_mbind, reinterpret_cast<void*>(begin), end - begin,
+                 kPreferred, mask, kMaxNodes + 1, kMove) == 0;
+#else
+  (void)ptr;
+  (void)bytes;
+  (void)node;
+  return false;
+#endif
+}
+
 #if HWY_OS_LINUX
 namespace {
 
@@ -320,8 +368,117 @@ const char* kPackage =
     "/sys/devices/system/cpu/cpu%zu/topology/physical_package_id";
 const char* kCluster = "/sys/devices/system/cpu/cpu%zu/cache/index3/id";
 const char* kCore = "/sys/devices/system/cpu/cpu%zu/topology/core_id";
-const char* kL2Size = "/sys/devices/system/cpu/cpu%zu/cache/index2/size";
-const char* kL3Size = "/sys/devices/system/cpu/cpu%zu/cache/index3/size";
+const char* kNodeCpus = "/sys/devices/system/node/node%zu/cpulist";
+
+// Reads file `name` of cache `index` of `lp` into `buf200`. Returns number of
+// bytes read or 0 on failure.
+size_t ReadCacheFile(size_t lp, size_t index, const char* name,
+                     char* buf200) {
+  char path[200];
+  const int bytes_written = snprintf(
+      path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/cache/index%zu/%s",
+      lp, index, name);
+  HWY_ASSERT(0 < bytes_written &&
+             bytes_written < static_cast<int>(sizeof(path) - 1));
+  const File file(path);
+  return file.Read(buf200);
+}
+
+// Sets the cache sizes of `cluster` from those of `lp`. The index of a cache
+// is not necessarily its level, hence check the level and type.
+void DetectCaches(size_t lp, Topology::Cluster& cluster) {
+  // Enough for L1d, L1i, L2, L3 and possibly L4.
+  constexpr size_t kMaxCaches = 8;
+  for (size_t index = 0; index < kMaxCaches; ++index) {
+    char buf200[200];
+    size_t pos = ReadCacheFile(lp, index, "level", buf200);
+    size_t level;
+    if (pos == 0 || !ParseSysfs(buf200, pos, &level)) break;  // no more caches
+
+    // "Data", "Instruction" or "Unified".
+    pos = ReadCacheFile(lp, index, "type", buf200);
+    if (pos == 0 || buf200[0] == 'I') continue;
+
+    size_t bytes;
+    pos = ReadCacheFile(lp, index, "size", buf200);
+    if (pos == 0 || !ParseSysfs(buf200, pos, &bytes)) continue;
+    if (level == 1) cluster.l1d_kib = bytes >> 10;
+    if (level == 2) cluster.private_kib = bytes >> 10;
+    if (level == 3) cluster.shared_kib = bytes >> 10;
+
+    size_t line_bytes;
+    pos = ReadCacheFile(lp, index, "coherency_line_size", buf200);
+    if (level == 1 && pos != 0 && ParseSysfs(buf200, pos, &line_bytes)) {
+      cluster.line_bytes = line_bytes;
+    }
+  }
+}
+
+// Calls `func(i)` for each `i` in a sysfs list such as "0-3,8,10-11\n".
+// Returns false if the list is malformed.
+template <class Func>
+bool ParseList(const char* str, size_t len, const Func& func) {
+  size_t pos = 0;
+  const auto parse_number = [&](size_t* out) {
+    const size_t begin = pos;
+    size_t value = 0;
+    // 9 digits cannot overflow even 32-bit size_t.
+    for (; pos < HWY_MIN(len, begin + 9); ++pos) {
+      const int c = str[pos];
+      if (c < '0' || c > '9') break;
+      value = value * 10 + static_cast<size_t>(c - '0');
+    }
+    *out = value;
+    return pos != begin;
+  };
+
+  for (;;) {
+    size_t first, last;
+    if (!parse_number(&first)) return false;
+    last = first;
+    if (pos < len && str[pos] == '-') {
+      ++pos;
+      if (!parse_number(&last) || last < first) return false;
+    }
+    for (size_t i = first; i <= last; ++i) {
+      func(i);
+    }
+    if (pos >= len || str[pos] != ',') return true;
+    ++pos;
+  }
+}
+
+// Sets `Topology::LP::node` and returns the LPs of each node, or an empty
+// vector if unknown.
+std::vector<LogicalProcessorSet> DetectNodes(std::vector<Topology::LP>& lps) {
+  std::vector<LogicalProcessorSet> nodes;
+  const File online("/sys/devices/system/node/online");
+  char buf200[200];
+  const size_t online_pos = online.Read(buf200);
+  if (online_pos == 0) return nodes;
+
+  const bool ok = ParseList(buf200, online_pos, [&](size_t node) {
+    // LP::node is 8-bit; ignore the (unlikely) larger node numbers.
+    if (node >= 256) return;
+    if (node >= nodes.size()) nodes.resize(node + 1);
+    char cpus200[200];
+    char path[200];
+    const int bytes_written = snprintf(path, sizeof(path), kNodeCpus, node);
+    HWY_ASSERT(0 < bytes_written &&
+               bytes_written < static_cast<int>(sizeof(path) - 1));
+    const File file(path);
+    const size_t pos = file.Read(cpus200);
+    // A node may have memory but no LPs, in which case cpulist is empty.
+    if (pos == 0) return;
+    (void)ParseList(cpus200, pos, [&](size_t lp) {
+      if (lp >= lps.size()) return;
+      lps[lp].node = static_cast<uint8_t>(node);
+      nodes[node].Set(lp);
+    });
+  });
+  if (!ok) nodes.clear();
+  return nodes;
+}
 
 // sysfs values can be arbitrarily large, so store in a map and replace with
 // indices in order of appearance.
@@ -385,43 +542,55 @@ std::vector<PerPackage> DetectPackages(std::vector<Topology::LP>& lps) {
 }  // namespace
 #endif  // HWY_OS_LINUX
 
-HWY_CONTRIB_DLLEXPORT Topology::Topology() {
+namespace {
+
+// Detection requires thousands of sysfs reads on large systems, hence only do
+// this once.
+struct DetectedTopology {
+  DetectedTopology() {
 #if HWY_OS_LINUX
-  lps.resize(TotalLogicalProcessors());
-  const std::vector<PerPackage>& per_package = DetectPackages(lps);
-  if (per_package.empty()) return;
-
-  // Allocate per-package/cluster/core vectors. This indicates to callers that
-  // detection succeeded.
-  packages.resize(per_package.size());
-  for (size_t p = 0; p < packages.size(); ++p) {
-    packages[p].clusters.resize(per_package[p].clusters.Num());
-    packages[p].cores.resize(per_package[p].cores.Num());
-  }
+    lps.resize(TotalLogicalProcessors());
+    const std::vector<PerPackage>& per_package = DetectPackages(lps);
+    if (per_package.empty()) return;
+
+    // Allocate per-package/cluster/core vectors. This indicates to callers
+    // that detection succeeded.
+    packages.resize(per_package.size());
+    for (size_t p = 0; p < packages.size(); ++p) {
+      packages[p].clusters.resize(per_package[p].clusters.Num());
+      packages[p].cores.resize(per_package[p].cores.Num());
+    }
 
-  // Populate the per-cluster/core sets of LP.
-  for (size_t lp = 0; lp < lps.size(); ++lp) {
-    Package& p = packages[lps[lp].package];
-    p.clusters[lps[lp].cluster].lps.Set(lp);
-    p.cores[lps[lp].core].lps.Set(lp);
-  }
+    // Populate the per-cluster/core sets of LP.
+    for (size_t lp = 0; lp < lps.size(); ++lp) {
+      Topology::Package& p = packages[lps[lp].package];
+      p.clusters[lps[lp].cluster].lps.Set(lp);
+      p.cores[lps[lp].core].lps.Set(lp);
+    }
 
-  // Detect cache sizes (only once per cluster)
-  for (size_t ip = 0; ip < packages.size(); ++ip) {
-    Package& p = packages[ip];
-    for (size_t ic = 0; ic < p.clusters.size(); ++ic) {
-      Cluster& c = p.clusters[ic];
-      const size_t lp = c.lps.First();
-      size_t bytes;
-      if (ReadSysfs(kL2Size, lp, &bytes)) {
-        c.private_kib = bytes >> 10;
-      }
-      if (ReadSysfs(kL3Size, lp, &bytes)) {
-        c.shared_kib = bytes >> 10;
+    // Detect cache sizes (only once per cluster)
+    for (Topology::Package& p : packages) {
+      for (Topology::Cluster& c : p.clusters) {
+        DetectCaches(c.lps.First(), c);
       }
     }
-  }
+
+    nodes = DetectNodes(lps);
 #endif
+  }
+
+  std::vector<Topology::Package> packages;
+  std::vector<Topology::LP> lps;
+  std::vector<LogicalProcessorSet> nodes;
+};
+
+}  // namespace
+
+HWY_CONTRIB_DLLEXPORT Topology::Topology() {
+  static const DetectedTopology detected;
+  packages = detected.packages;
+  lps = detected.lps;
+  nodes = detected.nodes;
 }
 
 }  // namespace hwy
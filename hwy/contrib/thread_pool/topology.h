@@ -60,19 +60,38 @@ static inline bool PinThreadToLogicalProcessor(size_t lp) {
 // via GetThreadAffinity().
 HWY_CONTRIB_DLLEXPORT size_t TotalLogicalProcessors();
 
+// Returns the size of a (small) virtual memory page, or 4096 if unknown.
+HWY_CONTRIB_DLLEXPORT size_t PageBytes();
+
+// Returned by `CurrentNode` and `Topology::NodeFor` if unknown.
+static constexpr size_t kUnknownNode = ~size_t{0};
+
+// Returns the NUMA node of the logical processor on which the current thread
+// is running, or `kUnknownNode`. Only stable if the thread is pinned.
+HWY_CONTRIB_DLLEXPORT size_t CurrentNode();
+
+// Requests that the pages entirely within `[ptr, ptr + bytes)` reside on NUMA
+// `node`, which also migrates pages that were already touched. Returns false
+// if not supported (currently only implemented on Linux), if the range
+// contains no whole page, or if the OS refused, e.g. due to a seccomp filter.
+HWY_CONTRIB_DLLEXPORT bool BindMemoryToNode(void* ptr, size_t bytes,
+                                            size_t node);
+
 struct Topology {
-  // Caller must check packages.empty(); if so, do not use any fields.
+  // Caller must check packages.empty(); if so, do not use any fields. The
+  // first call detects the topology, subsequent calls return a copy.
   HWY_CONTRIB_DLLEXPORT Topology();
 
   // Clique of cores with lower latency to each other. On Apple M1 these are
   // four cores sharing an L2. On Zen4 these 'CCX' are up to eight cores sharing
   // an L3 and a memory controller, or for Zen4c up to 16 and half the L3 size.
+  // Cache sizes are those of the first LP in the cluster.
   struct Cluster {
     LogicalProcessorSet lps;
-    uint64_t private_kib = 0;  // 0 if unknown
-    uint64_t shared_kib = 0;   // 0 if unknown
-    uint64_t reserved1 = 0;
-    uint64_t reserved2 = 0;
+    uint64_t private_kib = 0;  // L2 size, 0 if unknown
+    uint64_t shared_kib = 0;   // L3 size, 0 if unknown
+    uint64_t l1d_kib = 0;      // L1 data cache size, 0 if unknown
+    uint64_t line_bytes = 0;   // cache line size, 0 if unknown
     uint64_t reserved3 = 0;
   };
 
@@ -96,11 +115,46 @@ struct Topology {
     uint8_t package = 0;   // < packages.size()
     uint8_t smt = 0;       // < packages[package].cores[core].lps.Count()
 
-    uint8_t reserved1 = 0;
+    uint8_t node = 0;  // NUMA node number (as used by the OS), see NodeFor
     uint8_t reserved2 = 0;
   };
 #pragma pack(pop)
   std::vector<LP> lps;  // size() == TotalLogicalProcessors().
+
+  // LPs of each NUMA node, indexed by node number. Empty if unknown. Node
+  // numbers need not be contiguous, hence some sets may be empty.
+  std::vector<LogicalProcessorSet> nodes;
+
+  // Helpers for sizing tiles etc. Return 0 if unknown, including if
+  // packages.empty(). `lp` must be less than `lps.size()`.
+
+  // Returns nullptr if packages.empty().
+  const Cluster* ClusterFor(size_t lp) const {
+    if (packages.empty()) return nullptr;
+    const LP& l = lps[lp];
+    return &packages[l.package].clusters[l.cluster];
+  }
+  size_t L1dBytesFor(size_t lp) const {
+    const Cluster* c = ClusterFor(lp);
+    return c ? static_cast<size_t>(c->l1d_kib << 10) : 0;
+  }
+  size_t L2BytesFor(size_t lp) const {
+    const Cluster* c = ClusterFor(lp);
+    return c ? static_cast<size_t>(c->private_kib << 10) : 0;
+  }
+  size_t L3BytesFor(size_t lp) const {
+    const Cluster* c = ClusterFor(lp);
+    return c ? static_cast<size_t>(c->shared_kib << 10) : 0;
+  }
+  size_t LineBytesFor(size_t lp) const {
+    const Cluster* c = ClusterFor(lp);
+    return c ? static_cast<size_t>(c->line_bytes) : 0;
+  }
+  // Returns `kUnknownNode` if nodes.empty().
+  size_t NodeFor(size_t lp) const {
+    if (nodes.empty()) return kUnknownNode;
+    return lps[lp].node;
+  }
 };
 
 }  // namespace hwy
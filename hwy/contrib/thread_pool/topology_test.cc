@@ -20,6 +20,7 @@
 
 #include <vector>
 
+#include "hwy/aligned_allocator.h"
 #include "hwy/base.h"
 #include "hwy/tests/hwy_gtest.h"
 #include "hwy/tests/test_util-inl.h"
@@ -73,6 +74,75 @@ TEST(TopologyTest, TestTopology) {
   HWY_ASSERT(lps_by_core == topology.lps.size());
   // .. and are a partition of unity (all LPs are covered)
   HWY_ASSERT(all_lps.Count() == topology.lps.size());
+
+  // Nodes, if known, are also a partition.
+  if (!topology.nodes.empty()) {
+    size_t lps_by_node = 0;
+    for (size_t node = 0; node < topology.nodes.size(); ++node) {
+      lps_by_node += topology.nodes[node].Count();
+      topology.nodes[node].Foreach([&](size_t lp) {
+        HWY_ASSERT(topology.NodeFor(lp) == node);
+      });
+    }
+    HWY_ASSERT(lps_by_node == topology.lps.size());
+  } else if (!topology.lps.empty()) {
+    HWY_ASSERT(topology.NodeFor(0) == kUnknownNode);
+  }
+
+  // Cache sizes, if known, increase with the level.
+  for (size_t lp = 0; lp < topology.lps.size(); ++lp) {
+    const size_t l1 = topology.L1dBytesFor(lp);
+    const size_t l2 = topology.L2BytesFor(lp);
+    const size_t l3 = topology.L3BytesFor(lp);
+    if (lp == 0) {
+      fprintf(stderr, "L1d %zu L2 %zu L3 %zu line %zu node %zu; %zu nodes\n",
+              l1, l2, l3, topology.LineBytesFor(lp), topology.NodeFor(lp),
+              topology.nodes.size());
+    }
+    if (l1 != 0 && l2 != 0) HWY_ASSERT(l1 < l2);
+    if (l2 != 0 && l3 != 0) HWY_ASSERT(l2 <= l3);
+    const size_t line = topology.LineBytesFor(lp);
+    if (line != 0) HWY_ASSERT(line >= 16 && (line & (line - 1)) == 0);
+  }
+
+  // Subsequent instances are copies.
+  const Topology copy;
+  HWY_ASSERT(copy.lps.size() == topology.lps.size());
+  HWY_ASSERT(copy.packages.size() == topology.packages.size());
+  HWY_ASSERT(copy.nodes.size() == topology.nodes.size());
+}
+
+// Detection may fail, in which case `lps` is still sized but `packages` is
+// empty. The helpers must then report unknown instead of indexing `packages`.
+TEST(TopologyTest, TestUnknownPackages) {
+  Topology topology;
+  topology.packages.clear();
+  if (topology.lps.empty()) topology.lps.resize(1);
+  for (size_t lp = 0; lp < topology.lps.size(); ++lp) {
+    HWY_ASSERT(topology.ClusterFor(lp) == nullptr);
+    HWY_ASSERT(topology.L1dBytesFor(lp) == 0);
+    HWY_ASSERT(topology.L2BytesFor(lp) == 0);
+    HWY_ASSERT(topology.L3BytesFor(lp) == 0);
+    HWY_ASSERT(topology.LineBytesFor(lp) == 0);
+  }
+}
+
+TEST(TopologyTest, TestNuma) {
+  const size_t page = PageBytes();
+  HWY_ASSERT(page >= 4096 && (page & (page - 1)) == 0);
+
+  const size_t node = CurrentNode();
+  fprintf(stderr, "Node %zu\n", node);
+  if (node == kUnknownNode) return;
+
+  // Ranges without a whole page are rejected.
+  auto bytes = AllocateAligned<uint8_t>(4 * page);
+  HWY_ASSERT(bytes);
+  HWY_ASSERT(!BindMemoryToNode(bytes.get() + 1, page - 1, node));
+  // May still fail if mbind is not permitted, but must not crash.
+  const bool bound = BindMemoryToNode(bytes.get(), 4 * page, node);
+  fprintf(stderr, "Bind %d\n", bound);
+  ZeroBytes(bytes.get(), 4 * page);
 }
 
 }  // namespace